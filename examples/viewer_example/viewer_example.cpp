@@ -40,6 +40,30 @@ bool AddIssue(void *issueToAdd)
     return true;
 }
 
+bool AddIssues(const tViewerIssueRecords *issues)
+{
+    if (issues->version != VIEWER_ISSUE_RECORDS_VERSION || issues->recordSize != sizeof(tViewerIssueRecord))
+    {
+        lasterrormsg = "ERROR: Unsupported issue record version.";
+        return false;
+    }
+
+    std::cout << "ADD ISSUES: " << issues->recordCount << " records" << std::endl;
+    for (uint64_t i = 0; i < issues->recordCount; i++)
+    {
+        const tViewerIssueRecord &record = issues->records[i];
+        std::cout << "ADD ISSUE " << record.issueId << ": " << issues->descriptions[record.descriptionIndex];
+
+        if (record.locationType == VIEWER_LOCATION_INERTIAL)
+            std::cout << " at x=" << record.x << " y=" << record.y << " z=" << record.z;
+        else if (record.locationType == VIEWER_LOCATION_TIME)
+            std::cout << " at time=" << record.time;
+
+        std::cout << std::endl;
+    }
+    return true;
+}
+
 bool ShowIssue(void *itemToShow, void *locationToShow)
 {
     auto issue = static_cast<cIssue *>(itemToShow);
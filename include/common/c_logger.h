@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cLogger_h__
+#define cLogger_h__
+
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+// Verbosity levels of log messages. A message is written if its level is at most the level of the logger.
+enum eLogLevel
+{
+    LOG_ERROR_LVL = 1,
+    LOG_WARNING_LVL = 2,
+    LOG_INFO_LVL = 3,
+    LOG_DEBUG_LVL = 4
+};
+
+/*
+ * Buffered logger for the diagnostics of all executables. Errors and warnings are written to stderr, info and
+ * debug messages to stdout. Errors are written immediately. Warnings and info messages are written immediately
+ * too if their stream is a terminal, otherwise they are collected in a buffer per stream and written in large
+ * blocks together with the debug messages. Messages of a category are only written up to a limit, further ones
+ * are counted and reported by WriteSummary(). The logger is thread safe.
+ *
+ * The initial level is read from the environment variable ASAM_QC_FRAMEWORK_LOG_LEVEL (error, warning, info or
+ * debug) and is info if it is not set.
+ */
+class cLogger
+{
+  public:
+    // Name of the environment variable with the initial log level
+    static const char ENV_LOG_LEVEL[];
+
+    // Count of messages per category which are written before further ones are suppressed
+    static const unsigned int DEFAULT_CATEGORY_LIMIT = 10;
+
+    // Returns the logger of the process
+    static cLogger &GetInstance();
+
+    // Returns the level for a name (error, warning, info, debug). Returns defaultLevel for unknown names.
+    static eLogLevel GetLogLevelFromStr(const std::string &strLevel, eLogLevel defaultLevel);
+
+    ~cLogger();
+
+    // Sets the level up to which messages are written
+    void SetLevel(eLogLevel level);
+
+    // Returns the level up to which messages are written
+    eLogLevel GetLevel() const;
+
+    // Returns true if messages of a level are written
+    bool IsEnabled(eLogLevel level) const;
+
+    // Sets the count of messages per category which are written. 0 disables the limit.
+    void SetCategoryLimit(unsigned int limit);
+
+    /*
+     * Logs a message. A line break is appended.
+     * \param level: Level of the message
+     * \param strMessage: The message
+     * \param category: Messages of the same category are rate limited. nullptr disables the limit.
+     */
+    void Log(eLogLevel level, const std::string &strMessage, const char *category = nullptr);
+
+    // Writes the buffered output
+    void Flush();
+
+    // Writes the counts of errors, warnings and suppressed messages, if there are any, and flushes
+    void WriteSummary();
+
+    // Returns the count of messages which were logged with a level, including suppressed ones
+    unsigned int GetMessageCount(eLogLevel level) const;
+
+    // Returns the count of messages which were suppressed by the category limit
+    unsigned int GetSuppressedCount() const;
+
+  private:
+    cLogger();
+
+    cLogger(const cLogger &) = delete;
+    cLogger &operator=(const cLogger &) = delete;
+
+    // Appends a message to the buffer of its stream and writes the buffer if needed. Expects a locked mutex.
+    void Write(eLogLevel level, const std::string &strText);
+
+    // Writes the buffer of one stream. Expects a locked mutex.
+    void FlushBuffer(bool errorStream);
+
+    mutable std::mutex m_Mutex;
+
+    eLogLevel m_Level;
+    unsigned int m_CategoryLimit;
+
+    // True if stdout is written to a terminal
+    bool m_IsOutTerminal;
+    // True if stderr is written to a terminal
+    bool m_IsErrorTerminal;
+
+    std::string m_OutBuffer;
+    std::string m_ErrorBuffer;
+
+    // Counts per level, index is the level
+    unsigned int m_MessageCount[LOG_DEBUG_LVL + 1];
+
+    // Count of messages per category
+    std::map<std::string, unsigned int> m_CategoryCount;
+};
+
+/*
+ * Collects a message with stream operators and logs it at the end of the statement, e.g.
+ * LogError() << "Could not read file '" << strFile << "'!";
+ * Values are not formatted if the level is disabled.
+ */
+class cLogMessage
+{
+  public:
+    cLogMessage(eLogLevel level, const char *category);
+
+    ~cLogMessage();
+
+    template <typename T> cLogMessage &operator<<(const T &value)
+    {
+        if (m_Enabled)
+            m_Stream << value;
+        return *this;
+    }
+
+  private:
+    eLogLevel m_Level;
+    const char *m_Category;
+    bool m_Enabled;
+    std::ostringstream m_Stream;
+};
+
+// Returns a message with error level. Messages with the same category are rate limited.
+cLogMessage LogError(const char *category = nullptr);
+
+// Returns a message with warning level. Messages with the same category are rate limited.
+cLogMessage LogWarning(const char *category = nullptr);
+
+// Returns a message with info level. Messages with the same category are rate limited.
+cLogMessage LogInfo(const char *category = nullptr);
+
+// Returns a message with debug level. Messages with the same category are rate limited.
+cLogMessage LogDebug(const char *category = nullptr);
+
+#endif
@@ -12,14 +12,18 @@
 #define cChecker_h__
 
 #include "../util.h"
+#include "../util_parallel.h"
 #include "../xml/util_xerces.h"
 #include "c_issue.h"
+#include "c_issue_counter.h"
 #include "c_metadata.h"
 #include "c_parameter_container.h"
 #include "c_rule.h"
 
+#include <algorithm>
 #include <list>
 #include <string>
+#include <vector>
 
 // Forward declaration to avoid problems with circular dependencies (especially under Linux)
 class cCheckerBundle;
@@ -33,6 +37,7 @@ class cMetadata;
 class cChecker
 {
     friend class cCheckerBundle;
+    friend class cResultContainer;
     friend class cIssue;
     friend class cRule;
     friend class cMetadata;
@@ -96,7 +101,10 @@ class cChecker
     static cChecker *ParseFromXML(DOMNode *pXMLNode, DOMElement *pXMLElement, cCheckerBundle *checkerBundle);
 
     // Counts the Issues
-    unsigned int GetIssueCount();
+    unsigned int GetIssueCount() const;
+
+    // Counts the Issues with a given level
+    unsigned int GetIssueCount(eIssueLevel level) const;
 
     // Counts the Rules
     unsigned int GetRuleCount();
@@ -119,6 +127,14 @@ class cChecker
     // Processes every issue and does a defined processing
     void DoProcessing(void (*funcIzteratorPtr)(cIssue *));
 
+    /*
+     * Processes every issue with a callable which takes a cIssue*.
+     * With eExecutionPolicy::PARALLEL the issues are split into chunks which are processed concurrently. The callable
+     * may change its issue, including the level and the enabled state, but must not add or remove issues or query the
+     * result container. Counters are updated when all issues are processed.
+     */
+    template <typename TFunc> void DoProcessing(TFunc &&func, eExecutionPolicy policy);
+
     // Returns the checkerBundle where this checker belongs to
     cCheckerBundle *GetCheckerBundle() const;
 
@@ -186,21 +202,31 @@ class cChecker
      */
     cParameterContainer *GetParamContainer();
 
+    // Removes and deletes all issues which are not in the range of the given levels
     void FilterIssues(eIssueLevel minLevel, eIssueLevel maxLevel);
 
-    std::size_t GetEnabledIssuesCount();
+    // Counts the enabled Issues
+    std::size_t GetEnabledIssuesCount() const;
+
+    // Counts the enabled Issues with a given level
+    std::size_t GetEnabledIssuesCount(eIssueLevel level) const;
+
+    // Returns the counter which is kept up to date while issues are added, filtered, enabled or disabled
+    const cIssueCounter &GetIssueCounter() const;
 
   protected:
     // Creates a new checker instance
     cChecker(const std::string &strCheckerId, const std::string &strDescription, const std::string &strSummary,
              const std::string &strStatus)
         : m_Bundle(nullptr), m_CheckerId(strCheckerId), m_Description(strDescription), m_Summary(strSummary),
-          m_Status(strStatus)
+          m_Status(strStatus), m_IsCountedInBundle(false), m_DefersUpdates(false)
     {
     }
 
     // Creates a new checker instance
-    cChecker() : m_Bundle(nullptr), m_CheckerId(""), m_Description(""), m_Summary(""), m_Status("completed")
+    cChecker()
+        : m_Bundle(nullptr), m_CheckerId(""), m_Description(""), m_Summary(""), m_Status("completed"),
+          m_IsCountedInBundle(false), m_DefersUpdates(false)
     {
     }
 
@@ -212,6 +238,33 @@ class cChecker
     // Returns the next free ID
     unsigned long long NextFreeId() const;
 
+    // Adds or removes an issue from the counters of this checker and its bundle
+    void CountIssue(const cIssue *issue, bool add);
+
+    // Updates the counters after the enabled state of an issue changed
+    void OnIssueEnabledChanged(const cIssue *issue);
+
+    // Updates the counters after the level of an issue changed
+    void OnIssueLevelChanged(const cIssue *issue, eIssueLevel oldLevel);
+
+    // Drops the query indexes of the result container after issues changed
+    void InvalidateQueryIndex() const;
+
+    /*
+     * Processes the issues of several checkers concurrently in chunks of similar size, independent of the checker
+     * boundaries. The callable takes (cChecker*, cIssue*). While the chunks are processed, the checkers do not update
+     * their counters and the query index, so the callable may change the level and the enabled state of its issue.
+     * Afterwards the counters are recomputed and the query index is dropped in the calling thread.
+     */
+    template <typename TFunc>
+    static void ProcessIssuesConcurrently(const std::vector<cChecker *> &checkers, TFunc &&func);
+
+    // Stops updating the counters and the query index while the issues are processed concurrently
+    void BeginDeferredUpdates();
+
+    // Recomputes the counters from the issues and drops the query index after concurrent processing
+    void EndDeferredUpdates();
+
     std::string m_CheckerId;
     std::string m_Description;
     std::string m_Summary;
@@ -222,6 +275,71 @@ class cChecker
     std::list<cRule *> m_Rules;
     std::list<cMetadata *> m_Metadata;
     cParameterContainer m_Params;
+
+    cIssueCounter m_IssueCounter;
+    // True if the counters of this checker are part of the counters of its bundle
+    bool m_IsCountedInBundle;
+    // True while the issues are processed concurrently and the counters are not updated
+    bool m_DefersUpdates;
 };
 
+template <typename TFunc> void cChecker::DoProcessing(TFunc &&func, eExecutionPolicy policy)
+{
+    if (policy == eExecutionPolicy::SEQUENTIAL)
+    {
+        for (cIssue *issue : m_Issues)
+            func(issue);
+        return;
+    }
+
+    ProcessIssuesConcurrently({this}, [&](cChecker *, cIssue *issue) { func(issue); });
+}
+
+template <typename TFunc>
+void cChecker::ProcessIssuesConcurrently(const std::vector<cChecker *> &checkers, TFunc &&func)
+{
+    // Issues of all checkers in one list. starts[i] is the index of the first issue of checkers[i].
+    std::vector<cIssue *> issues;
+    std::vector<std::size_t> starts;
+    starts.reserve(checkers.size());
+    for (cChecker *checker : checkers)
+    {
+        starts.push_back(issues.size());
+        issues.insert(issues.end(), checker->m_Issues.begin(), checker->m_Issues.end());
+        checker->BeginDeferredUpdates();
+    }
+
+    const std::size_t chunkCount = std::min<std::size_t>(issues.size(), 4 * (std::size_t)GetDefaultWorkerCount());
+
+    try
+    {
+        ForEachIndex(
+            chunkCount,
+            [&](std::size_t chunk) {
+                const std::size_t begin = issues.size() * chunk / chunkCount;
+                const std::size_t end = issues.size() * (chunk + 1) / chunkCount;
+
+                // Last checker which starts at or before the chunk, so empty checkers are skipped
+                std::size_t checker = (std::size_t)(std::upper_bound(starts.begin(), starts.end(), begin) -
+                                                    starts.begin() - 1);
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    while (checker + 1 < starts.size() && starts[checker + 1] <= i)
+                        checker++;
+                    func(checkers[checker], issues[i]);
+                }
+            },
+            eExecutionPolicy::PARALLEL);
+    }
+    catch (...)
+    {
+        for (cChecker *checker : checkers)
+            checker->EndDeferredUpdates();
+        throw;
+    }
+
+    for (cChecker *checker : checkers)
+        checker->EndDeferredUpdates();
+}
+
 #endif
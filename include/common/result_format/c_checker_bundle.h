@@ -16,6 +16,7 @@
 #include "c_parameter_container.h"
 #include "common/result_format/c_checker.h"
 #include "common/result_format/c_issue.h"
+#include "common/result_format/c_issue_counter.h"
 
 // Forward declaration to avoid problems with circular dependencies (especially under Linux)
 class cResultContainer;
@@ -39,7 +40,7 @@ class cCheckerBundle
      * Creates a new checker bundle
      *
      */
-    cCheckerBundle(const std::string &checkerName) : m_CheckerName(checkerName)
+    cCheckerBundle(const std::string &checkerName) : m_CheckerName(checkerName), m_Container(nullptr)
     {
     }
 
@@ -119,6 +120,9 @@ class cCheckerBundle
     // Counts the Issues
     unsigned int GetIssueCount() const;
 
+    // Counts the Issues with a given level
+    unsigned int GetIssueCount(eIssueLevel level) const;
+
     // Counts the Checkers
     unsigned int GetCheckerCount() const;
 
@@ -131,6 +135,14 @@ class cCheckerBundle
     // Processes every issue on every checker and does a defined processing
     void DoProcessing(void (*funcIteratorPtr)(cChecker *, cIssue *));
 
+    /*
+     * Processes every issue on every checker with a callable which takes (cChecker*, cIssue*).
+     * With eExecutionPolicy::PARALLEL the issues of all checkers are split into chunks which are processed
+     * concurrently. The callable may change its issue, including the level and the enabled state, but must not add or
+     * remove checkers or issues or query the result container. Counters are updated when all issues are processed.
+     */
+    template <typename TFunc> void DoProcessing(TFunc &&func, eExecutionPolicy policy);
+
     // Returns an issue by its id
     cIssue *GetIssueById(unsigned long long id) const;
 
@@ -218,9 +230,17 @@ class cCheckerBundle
      */
     cResultContainer const *GetResultContainer() const;
 
+    // Removes and deletes all checkers whose id is not in the given list
     void KeepCheckersFrom(const std::vector<std::string> &checkerIds);
 
-    std::size_t GetEnabledIssuesCount();
+    // Counts the enabled Issues
+    std::size_t GetEnabledIssuesCount() const;
+
+    // Counts the enabled Issues with a given level
+    std::size_t GetEnabledIssuesCount(eIssueLevel level) const;
+
+    // Returns the counter which sums up the counters of all checkers
+    const cIssueCounter &GetIssueCounter() const;
 
   protected:
     /*
@@ -230,7 +250,8 @@ class cCheckerBundle
                    const std::string &filepath, const std::string &description, const std::string &version,
                    const std::string &date)
         : m_CheckerName(checkerName), m_CheckerSummary(checkerSummary), m_Description(description),
-          m_FileName(fileName), m_FilePath(filepath), m_BuildVersion(version), m_BuildDate(date)
+          m_FileName(fileName), m_FilePath(filepath), m_BuildVersion(version), m_BuildDate(date),
+          m_Container(nullptr)
     {
     }
 
@@ -250,6 +271,24 @@ class cCheckerBundle
     std::list<cChecker *> m_Checkers;
     cParameterContainer m_Params;
     cResultContainer *m_Container;
+
+    cIssueCounter m_IssueCounter;
 };
 
+template <typename TFunc> void cCheckerBundle::DoProcessing(TFunc &&func, eExecutionPolicy policy)
+{
+    if (policy == eExecutionPolicy::SEQUENTIAL)
+    {
+        for (cChecker *checker : m_Checkers)
+        {
+            for (cIssue *issue : checker->m_Issues)
+                func(checker, issue);
+        }
+        return;
+    }
+
+    std::vector<cChecker *> checkers(m_Checkers.begin(), m_Checkers.end());
+    cChecker::ProcessIssuesConcurrently(checkers, func);
+}
+
 #endif
@@ -14,10 +14,17 @@
 #include "string"
 #include <xercesc/dom/DOMElement.hpp>
 
+XERCES_CPP_NAMESPACE_BEGIN
+class XercesDOMParser;
+XERCES_CPP_NAMESPACE_END
+
 XERCES_CPP_NAMESPACE_USE
 
 /*
- * Definition of domain specific information. This can be used to represent custom info in result file
+ * Definition of domain specific information. This can be used to represent custom info in result file.
+ *
+ * The xml tree is kept as a serialized UTF-8 fragment. A DOM document is only created when GetRoot() or GetDoc()
+ * is called, so results with many domain specific infos do not allocate one Xerces document per issue.
  */
 class cDomainSpecificInfo
 {
@@ -30,15 +37,14 @@ class cDomainSpecificInfo
      * \param inputRoot: xml tree root for the initialization
      * \param name: Name of the tag
      */
-    cDomainSpecificInfo(DOMElement *inputRoot, const std::string &name = "") : m_Name(name)
-    {
-        // Get the original document's implementation
-        DOMImplementation *impl = inputRoot->getOwnerDocument()->getImplementation();
-        // Create a new document to own the cloned element
-        m_Doc = impl->createDocument();
-        // Import the element into the new document, effectively cloning it
-        m_Root = dynamic_cast<DOMElement *>(m_Doc->importNode(inputRoot, true));
-    }
+    cDomainSpecificInfo(DOMElement *inputRoot, const std::string &name = "");
+
+    /*
+     * Creates a new instance of cDomainSpecificInfo from an already serialized xml fragment
+     * \param fragment: UTF-8 encoded xml fragment with a single root element
+     * \param name: Name of the tag
+     */
+    cDomainSpecificInfo(const std::string &fragment, const std::string &name);
 
     // Serialize this information
     virtual XERCES_CPP_NAMESPACE::DOMElement *WriteXML(XERCES_CPP_NAMESPACE::DOMDocument *p_resultDocument);
@@ -47,17 +53,48 @@ class cDomainSpecificInfo
     static cDomainSpecificInfo *ParseFromXML(XERCES_CPP_NAMESPACE::DOMNode *pXMLNode,
                                              XERCES_CPP_NAMESPACE::DOMElement *pXMLElement);
 
-    // Returns the root
+    // Returns the root. The DOM is created on first access.
     DOMElement *GetRoot() const;
     // Returns the name
     std::string GetName() const;
+    // Returns the document which owns the root. The DOM is created on first access.
     DOMDocument *GetDoc() const;
+    // Returns the serialized UTF-8 xml fragment
+    const std::string &GetFragment() const;
+    // Returns true if the DOM of this information has been created
+    bool IsMaterialized() const;
+
+    /*
+     * Parses the fragment into a new document, which is not kept by this information. Use it instead of GetRoot() to
+     * read the tree once without holding the DOM for the lifetime of the information.
+     * \return The document, owned by the caller, or nullptr on failure
+     */
+    DOMDocument *ParseFragment() const;
 
     ~cDomainSpecificInfo();
 
+    /*
+     * Shares one parser between all fragments parsed by the current thread while the scope exists, instead of
+     * creating a parser per fragment. Scopes can be nested and must be destroyed before Xerces is terminated.
+     */
+    class cParserScope
+    {
+      public:
+        cParserScope();
+        ~cParserScope();
+
+      private:
+        cParserScope(const cParserScope &);
+        cParserScope &operator=(const cParserScope &);
+
+        XercesDOMParser *m_Parser;
+        XercesDOMParser *m_PreviousParser;
+    };
+
   protected:
-    DOMElement *m_Root;
-    DOMDocument *m_Doc;
+    mutable DOMElement *m_Root;
+    mutable DOMDocument *m_Doc;
+    std::string m_Fragment;
     std::string m_Name;
 
   private:
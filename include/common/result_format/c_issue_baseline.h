@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cIssueBaseline_h__
+#define cIssueBaseline_h__
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+/*
+ * Definition of the handling of issues which are part of a baseline
+ */
+enum eBaselineMode
+{
+    BASELINE_DROP = 0,    // Suppressed issues are not created at all
+    BASELINE_DISABLE = 1 // Suppressed issues are created, but disabled
+};
+
+/*
+ * A set of accepted issues, identified by their fingerprints (see cIssueFingerprint). When a baseline is assigned
+ * to a result container, matching issues are suppressed while results are read with AddResultsFromXML().
+ *
+ * The baseline file contains one fingerprint as hex digits per line. Empty lines and lines starting with '#' are
+ * ignored.
+ */
+class cIssueBaseline
+{
+  public:
+    cIssueBaseline(eBaselineMode mode = BASELINE_DROP);
+
+    /*
+     * Adds the fingerprints of a baseline file
+     * \param strFilePath: Path to the baseline file
+     * \return False if the file could not be read
+     */
+    bool LoadFromFile(const std::string &strFilePath);
+
+    /*
+     * Writes all fingerprints to a baseline file
+     * \param strFilePath: Path to the baseline file
+     * \return False if the file could not be written
+     */
+    bool WriteToFile(const std::string &strFilePath) const;
+
+    // Adds a fingerprint
+    void Add(uint64_t fingerprint);
+
+    // Returns true if the fingerprint is part of the baseline
+    bool Contains(uint64_t fingerprint) const;
+
+    // Returns the count of fingerprints
+    std::size_t GetCount() const;
+
+    // Returns the mode
+    eBaselineMode GetMode() const;
+
+    // Sets the mode
+    void SetMode(eBaselineMode mode);
+
+    // Counts an issue which was suppressed by this baseline
+    void CountSuppressed();
+
+    // Returns the count of issues which were suppressed by this baseline
+    unsigned int GetSuppressedCount() const;
+
+    // Gets a mode from a given string ("drop" or "disable"). Returns false and leaves mode unchanged for unknown
+    // strings.
+    static bool GetModeFromStr(const std::string &strMode, eBaselineMode *mode);
+
+  protected:
+    std::unordered_set<uint64_t> m_Fingerprints;
+    eBaselineMode m_Mode;
+    unsigned int m_SuppressedCount;
+};
+
+#endif
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cIssueCounter_h__
+#define cIssueCounter_h__
+
+#include "c_issue.h"
+
+/*
+ * Counts issues in total, enabled issues and both per issue level. Checkers and checker bundles keep one
+ * instance up to date while issues are added, removed, enabled or disabled, so count queries need no traversal.
+ */
+class cIssueCounter
+{
+  public:
+    cIssueCounter();
+
+    // Counts an issue with the given level and state
+    void Add(eIssueLevel level, bool enabled);
+
+    // Removes an issue with the given level and state
+    void Remove(eIssueLevel level, bool enabled);
+
+    // Moves an issue between the enabled and disabled counts
+    void SetEnabled(eIssueLevel level, bool enabled);
+
+    // Adds all counts of another counter
+    void Add(const cIssueCounter &other);
+
+    // Removes all counts of another counter
+    void Remove(const cIssueCounter &other);
+
+    // Resets all counts to zero
+    void Reset();
+
+    // Returns the count of all issues
+    unsigned int GetCount() const;
+
+    // Returns the count of issues with a given level
+    unsigned int GetCount(eIssueLevel level) const;
+
+    // Returns the count of enabled issues
+    unsigned int GetEnabledCount() const;
+
+    // Returns the count of enabled issues with a given level
+    unsigned int GetEnabledCount(eIssueLevel level) const;
+
+  private:
+    // Index 0 holds the total, the levels are stored at their numeric value
+    static const int COUNT_SLOTS = INFO_LVL + 1;
+
+    // Returns the slot of a level or 0 if the level is unknown
+    static int GetSlot(eIssueLevel level);
+
+    unsigned int m_Count[COUNT_SLOTS];
+    unsigned int m_EnabledCount[COUNT_SLOTS];
+};
+
+#endif
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cIssueFingerprint_h__
+#define cIssueFingerprint_h__
+
+#include "c_issue.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+class cCheckerBundle;
+class cChecker;
+
+/*
+ * Calculates a stable 64 bit fingerprint of an issue, which identifies the same finding across different runs.
+ * The fingerprint covers the checker bundle name, checker id, rule UID, level, normalized description and the
+ * xml, inertial, time and message locations of the issue. Issue ids and file locations are left out, because
+ * they are assigned by the tooling and change between runs.
+ *
+ * The values have to be added in the order issue, locations. Use Compute() for issues in a result container and
+ * ComputeFromXML() for issues in a result file.
+ */
+class cIssueFingerprint
+{
+  public:
+    cIssueFingerprint();
+
+    // Adds the identifying attributes of an issue. Has to be called once before adding locations.
+    void AddIssue(const std::string &bundleName, const std::string &checkerID, const std::string &ruleUID,
+                  eIssueLevel level, const std::string &description);
+
+    // Adds a xml location
+    void AddXPath(const std::string &xpath);
+
+    // Adds an inertial location. Coordinates are rounded to micrometers.
+    void AddInertial(double x, double y, double z);
+
+    // Adds a time location
+    void AddTime(double time);
+
+    // Adds a message location
+    void AddMessage(uint64_t index, const std::optional<std::string> &channel, const std::optional<std::string> &field,
+                    const std::optional<double> &time);
+
+    // Returns the fingerprint of all values added so far
+    uint64_t GetValue() const;
+
+    // Calculates the fingerprint of an issue in a result container
+    static uint64_t Compute(const cCheckerBundle *bundle, const cChecker *checker, const cIssue *issue);
+
+    /*
+     * Calculates the fingerprint of a serialized issue without creating the issue and its locations. Returns the
+     * same value as Compute() for the parsed issue.
+     * \param bundleName: Name of the checker bundle the issue belongs to
+     * \param checkerID: Id of the checker the issue belongs to
+     * \param pXMLNode: The issue node
+     * \param pXMLElement: The issue element
+     */
+    static uint64_t ComputeFromXML(const std::string &bundleName, const std::string &checkerID,
+                                   XERCES_CPP_NAMESPACE::DOMNode *pXMLNode,
+                                   XERCES_CPP_NAMESPACE::DOMElement *pXMLElement);
+
+    // Removes surrounding whitespace, collapses inner whitespace and strips a leading issue id prefix ("#12: ")
+    static std::string NormalizeDescription(const std::string &description);
+
+    // Returns the fingerprint as 16 hex digits
+    static std::string ToString(uint64_t fingerprint);
+
+    // Parses a fingerprint from hex digits. Returns false if the string is no valid fingerprint.
+    static bool FromString(const std::string &strFingerprint, uint64_t &fingerprint);
+
+  protected:
+    // Mixes raw bytes into the hash
+    void AddBytes(const void *data, std::size_t size);
+
+    // Mixes a length prefixed string into the hash
+    void AddString(const std::string &value);
+
+    // Mixes a number into the hash
+    void AddNumber(uint64_t value);
+
+    // Mixes a rounded floating point number into the hash
+    void AddDouble(double value);
+
+    uint64_t m_Hash;
+};
+
+#endif
@@ -19,15 +19,24 @@
 
 #include "../util.h"
 #include "../xml/util_xerces.h"
+#include "c_issue.h"
+#include "c_result_query.h"
 
+#include <cstdint>
+#include <functional>
 #include <list>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 // Forward declaration to avoid problems with circular dependencies (especially under Linux)
 class cCheckerBundle;
 class cConfiguration;
 class cIssue;
 class cChecker;
+class cIssueBaseline;
+enum class eExecutionPolicy;
 
 class cResultContainer
 {
@@ -70,9 +79,34 @@ class cResultContainer
     */
     void AddResultsFromXML(const std::string &strXmlFilePath);
 
+    /*
+    Adds the results from a already existing XQAR file and reports the progress while the file is read
+    \param strXmlFilePath: Path to a existing QXAR file
+    \param progress: Called with the bytes read so far, see tProgressCallback. Returning false cancels reading.
+    \return False if the file is missing, could not be parsed or reading was cancelled. The container is unchanged
+    in this case.
+    */
+    bool AddResultsFromXML(const std::string &strXmlFilePath,
+                           const std::function<bool(uint64_t bytesRead, uint64_t bytesTotal)> &progress);
+
+    /*
+    Exchanges the results of two containers. The assigned baselines are not exchanged.
+    \param other: The other container
+    */
+    void Swap(cResultContainer &other);
+
     // Counts the Issues
     unsigned int GetIssueCount() const;
 
+    // Counts the Issues with a given level
+    unsigned int GetIssueCount(eIssueLevel level) const;
+
+    // Counts the enabled Issues
+    unsigned int GetEnabledIssuesCount() const;
+
+    // Counts the enabled Issues with a given level
+    unsigned int GetEnabledIssuesCount(eIssueLevel level) const;
+
     // Counts the Checkers
     unsigned int GetCheckerCount() const;
 
@@ -118,6 +152,15 @@ class cResultContainer
     // Processes every issue on every checkerbundle, checker and does a defined processing
     void DoProcessing(void (*funcIteratorPtr)(cCheckerBundle *, cChecker *, cIssue *));
 
+    /*
+     * Processes every issue on every checkerbundle and checker with a callable which takes
+     * (cCheckerBundle*, cChecker*, cIssue*). With eExecutionPolicy::PARALLEL the issues of all checkers are split into
+     * chunks which are processed concurrently. The callable may change its issue, including the level and the enabled
+     * state, but must not add or remove results or query the container. Counters are updated and the query index is
+     * dropped when all issues are processed.
+     */
+    void DoProcessing(const std::function<void(cCheckerBundle *, cChecker *, cIssue *)> &func, eExecutionPolicy policy);
+
     /*!
      * Converts a report to a configuration
      *
@@ -127,11 +170,40 @@ class cResultContainer
 
     cCheckerBundle *GetCheckerBundleByName(const std::string &strBundleName) const;
 
+    /*!
+     * Returns handles to all issues matching a query. The indexes needed by the query are built on first use
+     * and reused by later queries until the results change. Queries can be called from several threads, they are
+     * serialized. Changing the results while a query runs is not allowed.
+     *
+     * \param query The predicates the issues have to match
+     */
+    std::vector<cIssueHandle> Query(const cResultQuery &query) const;
+
+    // Drops the query indexes. Called automatically when results are added, removed or changed.
+    void InvalidateQueryIndex();
+
+    /*!
+     * Assigns a baseline of accepted issues. Issues of the baseline are dropped or disabled while results are read
+     * by AddResultsFromXML(). The container does not take the ownership.
+     *
+     * \param baseline The baseline or nullptr to read all issues
+     */
+    void SetBaseline(cIssueBaseline *baseline);
+
+    // Returns the assigned baseline or nullptr
+    cIssueBaseline *GetBaseline() const;
+
   protected:
     std::list<cCheckerBundle *> m_Bundles;
 
     unsigned long long m_NextFreeId = 0;
 
+    // Query index, built on first use, and the mutex which guards building, using and dropping it
+    class cQueryIndexState;
+    std::unique_ptr<cQueryIndexState> m_QueryIndex;
+
+    cIssueBaseline *m_Baseline = nullptr;
+
   private:
     // Returns the next free ID
     unsigned long long NextFreeId();
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cResultDiff_h__
+#define cResultDiff_h__
+
+#include "../util_parallel.h"
+#include "c_result_query.h"
+
+#include <cstdint>
+#include <vector>
+
+class cResultContainer;
+
+/*
+ * Compares the issues of two result containers by their fingerprints (see cIssueFingerprint). Issues are matched
+ * with a hash join, so the comparison takes linear time in the number of issues. Issues with equal fingerprints
+ * are matched pairwise, so duplicates which only occur more often in one of the results are reported as well.
+ *
+ * The handles point into the compared containers and stay valid as long as these containers are not modified.
+ */
+class cResultDiff
+{
+  public:
+    cResultDiff();
+
+    /*
+     * Compares two result containers
+     * \param base: Results of the reference run
+     * \param current: Results of the run to compare with the reference
+     * \param scope: Only issues matching this query are compared
+     * \param policy: PARALLEL calculates the fingerprints concurrently
+     */
+    void Compare(const cResultContainer &base, const cResultContainer &current,
+                 const cResultQuery &scope = cResultQuery(), eExecutionPolicy policy = eExecutionPolicy::PARALLEL);
+
+    // Returns the issues of the current results which are not in the base results
+    const std::vector<cIssueHandle> &GetAdded() const;
+
+    // Returns the issues of the base results which are not in the current results
+    const std::vector<cIssueHandle> &GetRemoved() const;
+
+    // Returns the issues of the current results which are also in the base results
+    const std::vector<cIssueHandle> &GetUnchanged() const;
+
+    // Removes the results of the last comparison
+    void Clear();
+
+    // Calculates the fingerprints of a list of issues
+    static std::vector<uint64_t> ComputeFingerprints(const std::vector<cIssueHandle> &handles,
+                                                     eExecutionPolicy policy = eExecutionPolicy::PARALLEL);
+
+  protected:
+    std::vector<cIssueHandle> m_Added;
+    std::vector<cIssueHandle> m_Removed;
+    std::vector<cIssueHandle> m_Unchanged;
+};
+
+#endif
@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cResultIndex_h__
+#define cResultIndex_h__
+
+#include "c_result_query.h"
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Secondary indexes over the issues of a result container. Every issue gets a row number in the order
+ * bundle -> checker -> issue. The indexes for the single predicates are built on their first use.
+ * The index has to be rebuilt whenever the results change, cResultContainer takes care of that.
+ * The index is not thread safe, cResultContainer serializes the queries.
+ */
+class cResultIndex
+{
+  public:
+    typedef std::vector<uint32_t> tRows;
+
+    // Creates the row table for the given checker bundles
+    explicit cResultIndex(const std::list<cCheckerBundle *> &bundles);
+
+    // Returns the count of rows
+    std::size_t GetRowCount() const;
+
+    // Returns the issue handle of a row
+    const cIssueHandle &GetHandle(uint32_t row) const;
+
+    // Returns the sorted rows which match a query
+    tRows Execute(const cResultQuery &query);
+
+  protected:
+    void BuildLevelIndex();
+    void BuildRuleIndex();
+    void BuildCheckerIndex();
+    void BuildBundleIndex();
+    void BuildLocationIndex();
+
+    // Returns the rows with a rule UID starting with the given prefix
+    tRows FindRuleRows(const std::string &prefix) const;
+    // Returns the rows with a xpath starting with the given prefix
+    tRows FindXPathRows(const std::string &prefix) const;
+    // Returns the rows with a time in [minTime, maxTime]
+    tRows FindTimeRows(double minTime, double maxTime) const;
+    // Returns the rows with an inertial location in the query box
+    tRows FindInertialRows(const cResultQuery &query) const;
+
+    std::vector<cIssueHandle> m_Rows;
+
+    bool m_HasLevelIndex;
+    std::vector<tRows> m_LevelRows;
+
+    bool m_HasRuleIndex;
+    std::map<std::string, tRows> m_RuleRows;
+
+    bool m_HasCheckerIndex;
+    std::unordered_map<std::string, tRows> m_CheckerRows;
+
+    bool m_HasBundleIndex;
+    std::unordered_map<std::string, tRows> m_BundleRows;
+
+    bool m_HasLocationIndex;
+    std::vector<uint8_t> m_LocationTypes;
+    std::vector<std::pair<std::string, uint32_t>> m_XPathRows;
+    std::vector<std::pair<double, uint32_t>> m_TimeRows;
+    std::vector<std::pair<std::array<double, 3>, uint32_t>> m_InertialRows;
+};
+
+#endif
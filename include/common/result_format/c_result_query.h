@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cResultQuery_h__
+#define cResultQuery_h__
+
+#include "c_issue.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+class cCheckerBundle;
+class cChecker;
+
+/*
+ * Definition of location types which can be used as query predicate
+ */
+enum class eLocationType
+{
+    FILE_LOCATION = 1,
+    XML_LOCATION = 2,
+    INERTIAL_LOCATION = 4,
+    TIME_LOCATION = 8,
+    MESSAGE_LOCATION = 16
+};
+
+/*
+ * Lightweight reference to an issue and its parents as returned by queries
+ */
+struct cIssueHandle
+{
+    cCheckerBundle *bundle;
+    cChecker *checker;
+    cIssue *issue;
+};
+
+/*
+ * Definition of a query on a result container. All predicates which are set have to match (AND). Multiple levels
+ * are combined with OR. Queries are executed by cResultContainer::Query().
+ *
+ * Example: cResultQuery().AddLevel(ERROR_LVL).SetRuleUIDPrefix("asam.net:xodr").SetBundleName("xodrBundle")
+ */
+class cResultQuery
+{
+  public:
+    cResultQuery();
+
+    // Matches issues with the given level. Can be called multiple times to match several levels.
+    cResultQuery &AddLevel(eIssueLevel level);
+
+    // Matches issues with exactly this rule UID
+    cResultQuery &SetRuleUID(const std::string &ruleUID);
+
+    // Matches issues whose rule UID starts with the given prefix
+    cResultQuery &SetRuleUIDPrefix(const std::string &ruleUIDPrefix);
+
+    // Matches issues of checkers with the given id
+    cResultQuery &SetCheckerID(const std::string &checkerID);
+
+    // Matches issues of checker bundles with the given name
+    cResultQuery &SetBundleName(const std::string &bundleName);
+
+    // Matches issues which have at least one location of the given type. Can be combined to require several types.
+    cResultQuery &AddLocationType(eLocationType locationType);
+
+    // Matches issues with a xml location whose xpath starts with the given prefix
+    cResultQuery &SetXPathPrefix(const std::string &xpathPrefix);
+
+    // Matches issues with a time or message location whose time is in [minTime, maxTime]
+    cResultQuery &SetTimeRange(double minTime, double maxTime);
+
+    // Matches issues with an inertial location inside the given axis aligned box
+    cResultQuery &SetInertialRange(double minX, double minY, double minZ, double maxX, double maxY, double maxZ);
+
+    // Matches only enabled issues
+    cResultQuery &SetEnabledOnly(bool enabledOnly = true);
+
+    // Returns the levels which are matched. Empty if all levels match.
+    const std::vector<eIssueLevel> &GetLevels() const;
+
+    // Returns the rule UID or prefix to match
+    const std::optional<std::string> &GetRuleUID() const;
+
+    // Returns true if the rule UID is matched as prefix
+    bool IsRuleUIDPrefix() const;
+
+    // Returns the checker id to match
+    const std::optional<std::string> &GetCheckerID() const;
+
+    // Returns the checker bundle name to match
+    const std::optional<std::string> &GetBundleName() const;
+
+    // Returns the combination of eLocationType flags which are required
+    unsigned int GetLocationTypes() const;
+
+    // Returns the xpath prefix to match
+    const std::optional<std::string> &GetXPathPrefix() const;
+
+    // Returns true if a time range is set
+    bool HasTimeRange() const;
+
+    // Returns the lower bound of the time range
+    double GetMinTime() const;
+
+    // Returns the upper bound of the time range
+    double GetMaxTime() const;
+
+    // Returns true if an inertial range is set
+    bool HasInertialRange() const;
+
+    // Returns the lower corner of the inertial range for the given axis (0 = x, 1 = y, 2 = z)
+    double GetInertialMin(int axis) const;
+
+    // Returns the upper corner of the inertial range for the given axis (0 = x, 1 = y, 2 = z)
+    double GetInertialMax(int axis) const;
+
+    // Returns true if only enabled issues are matched
+    bool IsEnabledOnly() const;
+
+  protected:
+    std::vector<eIssueLevel> m_Levels;
+    std::optional<std::string> m_RuleUID;
+    bool m_RuleUIDIsPrefix;
+    std::optional<std::string> m_CheckerID;
+    std::optional<std::string> m_BundleName;
+    unsigned int m_LocationTypes;
+    std::optional<std::string> m_XPathPrefix;
+    bool m_HasTimeRange;
+    double m_MinTime;
+    double m_MaxTime;
+    bool m_HasInertialRange;
+    double m_InertialMin[3];
+    double m_InertialMax[3];
+    bool m_EnabledOnly;
+};
+
+#endif
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _UTIL_PARALLEL_H__
+#define _UTIL_PARALLEL_H__
+
+#include <cstddef>
+#include <functional>
+
+/*
+ * Definition of execution policies for processing functions
+ */
+enum class eExecutionPolicy
+{
+    SEQUENTIAL,
+    PARALLEL
+};
+
+// Returns the number of workers which is used for parallel execution by default
+unsigned int GetDefaultWorkerCount();
+
+/*
+ * Calls a function for every index in [0, count).
+ * \param count: Number of work items
+ * \param func: Function which processes one work item
+ * \param policy: SEQUENTIAL processes the items in order in the calling thread. PARALLEL distributes the items
+ *                on a pool of worker threads. The first exception thrown by func is rethrown in the calling thread.
+ * \param workerCount: Number of workers for parallel execution. 0 uses the default worker count.
+ */
+void ForEachIndex(std::size_t count, const std::function<void(std::size_t)> &func,
+                  eExecutionPolicy policy = eExecutionPolicy::SEQUENTIAL, unsigned int workerCount = 0);
+
+#endif
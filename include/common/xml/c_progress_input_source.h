@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cProgressInputSource_h__
+#define cProgressInputSource_h__
+
+#include <xercesc/sax/InputSource.hpp>
+#include <xercesc/util/BinInputStream.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/*
+ * Callback which is called while a file is read.
+ * \param bytesRead: Number of bytes read so far
+ * \param bytesTotal: Size of the file
+ * \return False to cancel reading
+ */
+typedef std::function<bool(uint64_t bytesRead, uint64_t bytesTotal)> tProgressCallback;
+
+/*
+ * Input source for a local file, which reports the progress of the parser in bytes read. If the callback cancels
+ * reading, the stream ends early and IsCancelled() returns true. The parser reports this as an unexpected end of the
+ * document.
+ */
+class cProgressInputSource : public XERCES_CPP_NAMESPACE::InputSource
+{
+  public:
+    /*
+     * Creates a new input source
+     * \param strFilePath: Path of the file to read
+     * \param progress: Callback which is called after every block read from the file
+     */
+    cProgressInputSource(const std::string &strFilePath, tProgressCallback progress);
+
+    XERCES_CPP_NAMESPACE::BinInputStream *makeStream() const override;
+
+    // Returns true if reading was cancelled by the callback
+    bool IsCancelled() const;
+
+  private:
+    std::string m_FilePath;
+    tProgressCallback m_Progress;
+
+    // Set by the stream, which has no access to a non const source
+    mutable std::atomic<bool> m_Cancelled;
+};
+
+#endif
@@ -19,11 +19,78 @@
 
 #define VIEWER EXPORT_VIEWER
 
+#include <stdint.h>
+
+/**
+ * Version of the issue record layout passed to AddIssues
+ **/
+#define VIEWER_ISSUE_RECORDS_VERSION 1
+
+/**
+ * Index value for records without rule UID
+ **/
+#define VIEWER_NO_INDEX 0xFFFFFFFFu
+
+/**
+ * Location types of an issue record
+ **/
+#define VIEWER_LOCATION_NONE 0
+#define VIEWER_LOCATION_INERTIAL 1
+#define VIEWER_LOCATION_TIME 2
+
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+    /**
+     * One location of an issue. An issue has one record per inertial or time location, or a single record of type
+     * VIEWER_LOCATION_NONE if it has neither.
+     **/
+    typedef struct
+    {
+        /** The issue, pointer to a cIssue class. The same pointer is passed to ShowIssue. **/
+        const void *issue;
+        /** ID of the issue **/
+        uint64_t issueId;
+        /** Issue level: 1 error, 2 warning, 3 information **/
+        uint32_t level;
+        /** Index into the rule UID table, VIEWER_NO_INDEX if the issue has no rule UID **/
+        uint32_t ruleIndex;
+        /** Index into the description table **/
+        uint32_t descriptionIndex;
+        /** Index of the location of the issue, VIEWER_NO_INDEX for records without location **/
+        uint32_t locationIndex;
+        /** One of the VIEWER_LOCATION_ types **/
+        uint32_t locationType;
+        uint32_t reserved;
+        /** Inertial coordinates for VIEWER_LOCATION_INERTIAL **/
+        double x;
+        double y;
+        double z;
+        /** Time for VIEWER_LOCATION_TIME **/
+        double time;
+    } tViewerIssueRecord;
+
+    /**
+     * Issue records with their string tables. Equal strings are stored once.
+     **/
+    typedef struct
+    {
+        /** VIEWER_ISSUE_RECORDS_VERSION **/
+        uint32_t version;
+        /** Size of one record in bytes **/
+        uint32_t recordSize;
+        uint64_t recordCount;
+        const tViewerIssueRecord *records;
+        uint32_t ruleCount;
+        uint32_t descriptionCount;
+        /** UTF-8 rule UIDs **/
+        const char *const *rules;
+        /** UTF-8 issue descriptions **/
+        const char *const *descriptions;
+    } tViewerIssueRecords;
+
     /**
      * Is called if the viewer application should be startet from main menu
      **/
@@ -41,6 +108,12 @@ extern "C"
      **/
     VIEWER bool AddIssue(void *issueToAdd);
 
+    /**
+     * Optional. Is called once with all issues instead of AddIssue, if the viewer implements it.
+     * \param issues The issues as flat records. The records and strings are only valid during the call.
+     **/
+    VIEWER bool AddIssues(const tViewerIssueRecords *issues);
+
     /**
      * Is called if an issues has to be showed.
      * \param itemToShow The item which should be showed. Pointer to a cIssue class.
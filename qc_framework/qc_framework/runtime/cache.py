@@ -0,0 +1,308 @@
+# SPDX-License-Identifier: MPL-2.0
+# Copyright 2024, ASAM e.V.
+# This Source Code Form is subject to the terms of the Mozilla
+# Public License, v. 2.0. If a copy of the MPL was not distributed
+# with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+from __future__ import annotations
+
+import hashlib
+import os
+import shlex
+import shutil
+import string
+import tempfile
+import xml.etree.ElementTree as ET
+
+from typing import TYPE_CHECKING, Dict, List, Optional
+
+if TYPE_CHECKING:
+    from .models import Module
+
+
+# Changing the composition of the key invalidates all cached results
+CACHE_KEY_VERSION = "1"
+
+INPUT_FILE_PARAM_NAME = "InputFile"
+RESULT_FILE_PARAM_NAMES = ["strResultFile", "resultFile"]
+
+
+def hash_file(file_path: str) -> str:
+    r"""
+    Compute the sha256 hash of the contents of a file.
+
+    Args:
+        file_path: path of the file
+
+    Returns:
+        The hash as hexadecimal string
+    """
+    sha = hashlib.sha256()
+    with open(file_path, "rb") as file:
+        for chunk in iter(lambda: file.read(1024 * 1024), b""):
+            sha.update(chunk)
+    return sha.hexdigest()
+
+
+def get_params(element: ET.Element) -> Dict[str, str]:
+    r"""
+    Collect the Param children of a configuration element.
+
+    Args:
+        element: Config or CheckerBundle element
+
+    Returns:
+        The values of the parameters by name
+    """
+    return {
+        param.get("name"): param.get("value", "")
+        for param in element.findall("Param")
+        if param.get("name") is not None
+    }
+
+
+def get_bundle_elements(config_root: ET.Element, name: str) -> List[ET.Element]:
+    r"""
+    Find the configuration sections of a checker bundle.
+
+    Args:
+        config_root: root element of the configuration file
+        name: application name of the checker bundle
+
+    Returns:
+        The CheckerBundle elements of the bundle
+    """
+    return [
+        bundle
+        for bundle in config_root.findall("CheckerBundle")
+        if bundle.get("application") == name
+    ]
+
+
+def get_bundle_param(
+    config_root: ET.Element, bundle_elements: List[ET.Element], names: List[str]
+) -> Optional[str]:
+    r"""
+    Get a parameter of a checker bundle. Parameters of the bundle take
+    precedence over the global parameters of the configuration.
+
+    Args:
+        config_root: root element of the configuration file
+        bundle_elements: configuration sections of the bundle
+        names: accepted names of the parameter, in order of preference
+
+    Returns:
+        The value of the parameter or None if it is not set
+    """
+    for params in [get_params(bundle) for bundle in bundle_elements] + [
+        get_params(config_root)
+    ]:
+        for name in names:
+            if params.get(name):
+                return params[name]
+    return None
+
+
+def resolve_path(path: str, working_dir: str) -> str:
+    r"""
+    Resolve a path of the configuration. Modules are executed in the working
+    directory, so relative paths refer to it.
+
+    Args:
+        path: path as given in the configuration
+        working_dir: working directory of the execution
+
+    Returns:
+        The absolute path
+    """
+    path = os.path.expandvars(path)
+    if not os.path.isabs(path):
+        path = os.path.join(working_dir, path)
+    return os.path.abspath(path)
+
+
+def get_result_file_path(
+    config_root: ET.Element, name: str, working_dir: str
+) -> Optional[str]:
+    r"""
+    Get the path of the result file a checker bundle writes, the same way as
+    result pooling looks it up.
+
+    Args:
+        config_root: root element of the configuration file
+        name: application name of the checker bundle
+        working_dir: working directory of the execution
+
+    Returns:
+        The path of the result file or None if the configuration does not set it
+    """
+    result_file = get_bundle_param(
+        config_root, get_bundle_elements(config_root, name), RESULT_FILE_PARAM_NAMES
+    )
+    if result_file is None:
+        return None
+    return resolve_path(result_file, working_dir)
+
+
+def get_command_file_hashes(
+    module: "Module", config_file_path: str, working_dir: str, env: Dict[str, str]
+) -> List[str]:
+    r"""
+    Hash the files the command of a module refers to, e.g. its binary or
+    script. Arguments are resolved as paths relative to the working directory
+    and as commands on the PATH.
+
+    Args:
+        module: module whose command is examined
+        config_file_path: path of the configuration file, which is not hashed
+        working_dir: working directory of the execution
+        env: environment the command is executed with
+
+    Returns:
+        The hashes of the files
+    """
+    try:
+        tokens = shlex.split(module.exec_command, posix=os.name != "nt")
+    except ValueError:
+        return []
+
+    hashes = []
+    for token in tokens:
+        token = os.path.expandvars(string.Template(token).safe_substitute(env))
+        if not token:
+            continue
+
+        file_path = resolve_path(token, working_dir)
+        if not os.path.isfile(file_path):
+            file_path = shutil.which(token, path=env.get("PATH"))
+        if file_path is None or not os.path.isfile(file_path):
+            continue
+        try:
+            if os.path.samefile(file_path, config_file_path):
+                continue
+            hashes.append(hash_file(file_path))
+        except OSError:
+            continue
+
+    return hashes
+
+
+def compute_cache_key(
+    module: "Module",
+    config_root: ET.Element,
+    config_file_path: str,
+    working_dir: str,
+    env: Dict[str, str],
+) -> Optional[str]:
+    r"""
+    Compute the key of the result of a checker bundle. The key covers the
+    contents of the input file, the configuration of the bundle including the
+    global parameters, the command of the module and the files it refers to.
+
+    Args:
+        module: checker bundle module
+        config_root: root element of the configuration file
+        config_file_path: path of the configuration file
+        working_dir: working directory of the execution
+        env: environment the command is executed with
+
+    Returns:
+        The key as hexadecimal string or None if the result can not be cached,
+        because the input file or the result file is not known
+    """
+    bundle_elements = get_bundle_elements(config_root, module.name)
+    input_file = get_bundle_param(config_root, bundle_elements, [INPUT_FILE_PARAM_NAME])
+    if input_file is None:
+        return None
+
+    input_file_path = resolve_path(input_file, working_dir)
+    if not os.path.isfile(input_file_path):
+        return None
+
+    if get_result_file_path(config_root, module.name, working_dir) is None:
+        return None
+
+    sha = hashlib.sha256()
+
+    def add(text: str) -> None:
+        # The length keeps the boundaries of the parts unambiguous
+        data = text.encode()
+        sha.update(f"{len(data)}:".encode())
+        sha.update(data)
+
+    add(CACHE_KEY_VERSION)
+    add(hash_file(input_file_path))
+
+    for name, value in sorted(get_params(config_root).items()):
+        add(f"{name}={value}")
+    for bundle in bundle_elements:
+        bundle_xml = ET.tostring(bundle, encoding="unicode")
+        add(ET.canonicalize(bundle_xml, strip_text=True))
+
+    add(module.exec_command)
+    for file_hash in get_command_file_hashes(
+        module, config_file_path, working_dir, env
+    ):
+        add(file_hash)
+
+    return sha.hexdigest()
+
+
+def get_cache_file_path(cache_dir: str, key: str) -> str:
+    r"""
+    Get the path of a cached result file.
+
+    Args:
+        cache_dir: directory of the cache
+        key: cache key of the result
+
+    Returns:
+        The path of the cached result file
+    """
+    return os.path.join(cache_dir, key[:2], f"{key}.xqar")
+
+
+def restore_result(cache_dir: str, key: str, result_file_path: str) -> bool:
+    r"""
+    Copy a cached result file to the path where the checker bundle would write
+    it.
+
+    Args:
+        cache_dir: directory of the cache
+        key: cache key of the result
+        result_file_path: destination path
+
+    Returns:
+        True if the result was found in the cache
+    """
+    cache_file_path = get_cache_file_path(cache_dir, key)
+    if not os.path.isfile(cache_file_path):
+        return False
+
+    os.makedirs(os.path.dirname(result_file_path), exist_ok=True)
+    shutil.copyfile(cache_file_path, result_file_path)
+    return True
+
+
+def store_result(cache_dir: str, key: str, result_file_path: str) -> None:
+    r"""
+    Copy the result file of a checker bundle to the cache. The file is renamed
+    into place, so concurrent runs sharing the cache never see partial files.
+
+    Args:
+        cache_dir: directory of the cache
+        key: cache key of the result
+        result_file_path: result file written by the checker bundle
+    """
+    cache_file_path = get_cache_file_path(cache_dir, key)
+    os.makedirs(os.path.dirname(cache_file_path), exist_ok=True)
+
+    file_handle, temp_file_path = tempfile.mkstemp(
+        dir=os.path.dirname(cache_file_path), suffix=".tmp"
+    )
+    os.close(file_handle)
+    try:
+        shutil.copyfile(result_file_path, temp_file_path)
+        os.replace(temp_file_path, cache_file_path)
+    except BaseException:
+        os.remove(temp_file_path)
+        raise
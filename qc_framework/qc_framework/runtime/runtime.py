@@ -6,13 +6,17 @@
 from __future__ import annotations
 
 from argparse import ArgumentParser
+from concurrent.futures import ThreadPoolExecutor
 import datetime
 import os
 import subprocess
+import threading
+import xml.etree.ElementTree as ET
 
-from typing import TYPE_CHECKING, Dict
+from typing import TYPE_CHECKING, Dict, List, Optional
 
 from qc_baselib import Configuration
+from . import cache
 from .models import FrameworkManifest, ModuleManifest, ModuleType
 
 if TYPE_CHECKING:
@@ -22,46 +26,222 @@ if TYPE_CHECKING:
 FRAMEWORK_WORKING_DIR_VAR_NAME = "ASAM_QC_FRAMEWORK_WORKING_DIR"
 FRAMEWORK_CONFIG_PATH_VAR_NAME = "ASAM_QC_FRAMEWORK_CONFIG_FILE"
 
+# Keeps the lines of modules which are executed concurrently from interleaving
+_print_lock = threading.Lock()
+
+
+def print_module_output(text: str, prefix: str = "") -> None:
+    r"""
+    Print a line of module output. Lines printed from several threads are not
+    mixed.
+
+    Args:
+        text: text to be printed
+        prefix: prefix of the line, e.g. the name of the module
+    """
+    with _print_lock:
+        print(f"{prefix}{text}", flush=True)
+
+
+def create_module_env(config_file_path: str, working_dir: str) -> Dict[str, str]:
+    r"""
+    Create the environment modules are executed with.
+
+    Args:
+        config_file_path: defines the configuration file path
+        working_dir: defines the working directory
+
+    Returns:
+        The environment of the runtime with the framework variables
+    """
+    cmd_env = os.environ.copy()
+    cmd_env[FRAMEWORK_WORKING_DIR_VAR_NAME] = working_dir
+    cmd_env[FRAMEWORK_CONFIG_PATH_VAR_NAME] = config_file_path
+    return cmd_env
+
 
 def run_module_command(
-    module: "Module", config_file_path: str, working_dir: str
-) -> None:
+    module: "Module", config_file_path: str, working_dir: str, prefix: str = ""
+) -> int:
     r"""
     Execute command specified in module configured with information in the
-    provided configuration.
+    provided configuration. The output of the command is printed while it runs.
 
     Args:
         module: module to be executed
         config_file_path: defines the configuration file path
         working_dir: defines the working directory
+        prefix: prefix of every printed line, e.g. the name of the module
+
+    Returns:
+        The exit code of the command, or -1 if it could not be executed
     """
     try:
-        print(f"Executing command: {os.path.expandvars(module.exec_command)}")
+        print_module_output(
+            f"Executing command: {os.path.expandvars(module.exec_command)}", prefix
+        )
 
-        cmd_env = os.environ.copy()
-        cmd_env[FRAMEWORK_WORKING_DIR_VAR_NAME] = working_dir
-        cmd_env[FRAMEWORK_CONFIG_PATH_VAR_NAME] = config_file_path
+        cmd_env = create_module_env(config_file_path, working_dir)
 
-        process = subprocess.run(
+        with subprocess.Popen(
             module.exec_command,
             env=cmd_env,
             shell=True,
             stdout=subprocess.PIPE,
             stderr=subprocess.STDOUT,
-        )
+            text=True,
+            errors="replace",
+        ) as process:
+            for line in process.stdout:
+                print_module_output(line.rstrip("\r\n"), prefix)
 
         exit_code = process.returncode
         if exit_code == 0:
-            print("Command executed successfully.")
-            print("Output:")
+            print_module_output("Command executed successfully.", prefix)
         else:
-            print("Error occurred while executing the command.")
-            print("Error message:")
+            print_module_output(
+                f"Error occurred while executing the command. Exit code: {exit_code}",
+                prefix,
+            )
 
-        print(process.stdout.decode())
+        return exit_code
 
     except Exception as e:
-        print(f"Error: {str(e)}")
+        print_module_output(f"Error: {str(e)}", prefix)
+        return -1
+
+
+def run_checker_bundle(
+    checker_bundle: "Module",
+    config_file_path: str,
+    working_dir: str,
+    cache_dir: Optional[str] = None,
+    config_root: Optional[ET.Element] = None,
+    prefix: str = "",
+) -> None:
+    r"""
+    Execute a checker bundle. With a cache directory, the result file is
+    copied from the cache if the bundle was already executed with the same
+    input file, configuration and command. Otherwise the bundle is executed and
+    its result file is added to the cache. Errors while accessing the cache are
+    printed as warnings and do not stop the execution.
+
+    Args:
+        checker_bundle: bundle module to be executed
+        config_file_path: path of the current configuration file
+        working_dir: working directory to be used for current execution
+        cache_dir: directory of the result cache or None to always execute
+        config_root: root element of the configuration file, used with the cache
+        prefix: prefix of every printed line, e.g. the name of the module
+    """
+    print_module_output(f"Executing checker module:  {checker_bundle.name}", prefix)
+
+    if cache_dir is None or config_root is None:
+        run_module_command(checker_bundle, config_file_path, working_dir, prefix)
+        return
+
+    try:
+        key = cache.compute_cache_key(
+            checker_bundle,
+            config_root,
+            config_file_path,
+            working_dir,
+            create_module_env(config_file_path, working_dir),
+        )
+    except Exception as e:
+        print_module_output(f"Result cache not used: {str(e)}", prefix)
+        key = None
+
+    if key is None:
+        run_module_command(checker_bundle, config_file_path, working_dir, prefix)
+        return
+
+    result_file_path = cache.get_result_file_path(
+        config_root, checker_bundle.name, working_dir
+    )
+    try:
+        if cache.restore_result(cache_dir, key, result_file_path):
+            print_module_output(
+                f"Result restored from cache: {os.path.basename(result_file_path)}",
+                prefix,
+            )
+            return
+    except OSError as e:
+        print_module_output(f"Result not restored from cache: {str(e)}", prefix)
+
+    # A result file left from an earlier execution must not be cached
+    try:
+        last_modified = (
+            os.stat(result_file_path).st_mtime_ns
+            if os.path.isfile(result_file_path)
+            else None
+        )
+    except OSError:
+        last_modified = None
+
+    exit_code = run_module_command(
+        checker_bundle, config_file_path, working_dir, prefix
+    )
+
+    try:
+        if (
+            exit_code == 0
+            and os.path.isfile(result_file_path)
+            and os.stat(result_file_path).st_mtime_ns != last_modified
+        ):
+            cache.store_result(cache_dir, key, result_file_path)
+    except OSError as e:
+        print_module_output(f"Result not stored in cache: {str(e)}", prefix)
+
+
+def run_checker_bundles(
+    checker_bundles: List["Module"],
+    config_file_path: str,
+    working_dir: str,
+    jobs: int = 1,
+    cache_dir: Optional[str] = None,
+) -> None:
+    r"""
+    Execute checker bundles. With more than one job, up to jobs bundles are
+    executed concurrently and every line of their output is prefixed with the
+    name of the bundle. Returns when all bundles have finished.
+
+    Args:
+        checker_bundles: bundle modules to be executed
+        config_file_path: path of the current configuration file
+        working_dir: working directory to be used for current execution
+        jobs: maximum number of bundles executed concurrently
+        cache_dir: directory of the result cache or None to always execute
+    """
+    config_root = None
+    if cache_dir is not None:
+        config_root = ET.parse(config_file_path).getroot()
+
+    if jobs <= 1 or len(checker_bundles) <= 1:
+        for checker_bundle in checker_bundles:
+            run_checker_bundle(
+                checker_bundle, config_file_path, working_dir, cache_dir, config_root
+            )
+        return
+
+    # The threads only forward the output, the bundles run as separate processes
+    with ThreadPoolExecutor(max_workers=min(jobs, len(checker_bundles))) as executor:
+        futures = []
+        for checker_bundle in checker_bundles:
+            futures.append(
+                executor.submit(
+                    run_checker_bundle,
+                    checker_bundle,
+                    config_file_path,
+                    working_dir,
+                    cache_dir,
+                    config_root,
+                    f"[{checker_bundle.name}] ",
+                )
+            )
+
+        for future in futures:
+            future.result()
 
 
 def execute_modules(
@@ -70,6 +250,8 @@ def execute_modules(
     available_result_pooling: "Module",
     available_report_modules: Dict[str, "Module"],
     working_dir: str,
+    jobs: int = 1,
+    cache_dir: Optional[str] = None,
 ) -> None:
     r"""
     Execute the full sequence of operations, checker bundles, result
@@ -82,6 +264,8 @@ def execute_modules(
         available_result_pooling: result pooler module
         available_report_modules: available report modules as declared in manifests
         working_dir: working directory to be used for current execution
+        jobs: maximum number of checker bundles executed concurrently
+        cache_dir: directory of the checker bundle result cache or None
     """
     config = Configuration()
     config.load_from_file(config_file_path)
@@ -107,11 +291,11 @@ def execute_modules(
 
         report_modules.append(available_report_modules[name])
 
-    # Checker bundles
+    # Checker bundles, result pooling starts when all of them have finished
     print(f"Executing checker bundles")
-    for checker_bundle in checker_bundles:
-        print(f"Executing checker module:  {checker_bundle.name}")
-        run_module_command(checker_bundle, config_file_path, working_dir)
+    run_checker_bundles(
+        checker_bundles, config_file_path, working_dir, jobs, cache_dir
+    )
 
     # Result pooling
     print(f"Executing result pooling:  {available_result_pooling.name}")
@@ -125,7 +309,11 @@ def execute_modules(
 
 
 def execute_runtime(
-    config_file_path: str, manifest_file_path: str, working_dir: str
+    config_file_path: str,
+    manifest_file_path: str,
+    working_dir: str,
+    jobs: int = 1,
+    cache_dir: Optional[str] = None,
 ) -> None:
     r"""
     Execute all runtime operations defined in the input manifest over the
@@ -135,6 +323,8 @@ def execute_runtime(
         config_file_path: input configuration xml file path
         manifest_file_path: input manifest json file path
         working_dir: working directory
+        jobs: maximum number of checker bundles executed concurrently
+        cache_dir: directory of the checker bundle result cache or None
     """
 
     checker_bundles = {}
@@ -188,6 +378,8 @@ def execute_runtime(
         result_pooling,
         report_modules,
         working_dir,
+        jobs,
+        cache_dir,
     )
 
 
@@ -220,8 +412,26 @@ def main() -> None:
         required=False,
     )
 
+    parser.add_argument(
+        "--jobs",
+        type=int,
+        default=1,
+        help="Maximum number of checker bundles executed concurrently. Default: 1",
+        required=False,
+    )
+
+    parser.add_argument(
+        "--cache_dir",
+        type=str,
+        help="Directory where checker bundle results are cached and reused.",
+        required=False,
+    )
+
     args = parser.parse_args()
 
+    if args.jobs < 1:
+        parser.error("--jobs must be at least 1")
+
     working_dir = None
     if args.working_dir is None:
         formatted_now = datetime.datetime.now().strftime("%Y_%m_%d_%H_%M_%S_%f")
@@ -231,7 +441,12 @@ def main() -> None:
 
     os.makedirs(working_dir, exist_ok=True)
 
-    execute_runtime(args.config, args.manifest, working_dir)
+    cache_dir = None
+    if args.cache_dir is not None:
+        cache_dir = os.path.abspath(args.cache_dir)
+        os.makedirs(cache_dir, exist_ok=True)
+
+    execute_runtime(args.config, args.manifest, working_dir, args.jobs, cache_dir)
 
 
 if __name__ == "__main__":
@@ -10,6 +10,8 @@ import sys
 
 
 import qc_framework.runtime as runtime
+from qc_framework.runtime.runtime import run_checker_bundles
+from qc_framework.runtime.models import Module
 
 
 def on_windows() -> bool:
@@ -90,3 +92,131 @@ def test_3steps_manifest(monkeypatch):
     assert result_xqar_generated == True
     # Check that report txt file is correctly generated
     assert report_txt_generated == True
+
+
+def test_concurrent_checker_bundles(tmp_path, capsys):
+    # Every bundle writes a file, which has to exist when run_checker_bundles returns
+    checker_bundles = [
+        Module(
+            name=f"Bundle{i}",
+            exec_type="executable",
+            module_type="checker_bundle",
+            exec_command=f'"{sys.executable}" -c "import time; time.sleep(0.2); '
+            f"open(r'{tmp_path / f'bundle{i}.txt'}', 'w').write('done'); print('done')\"",
+        )
+        for i in range(4)
+    ]
+
+    run_checker_bundles(checker_bundles, "", str(tmp_path), jobs=2)
+
+    for i in range(4):
+        assert (tmp_path / f"bundle{i}.txt").read_text() == "done"
+
+    # The output of every bundle is streamed with its name as prefix, starting when
+    # the bundle is executed instead of queued
+    output = capsys.readouterr().out
+    for i in range(4):
+        assert f"[Bundle{i}] Executing checker module:  Bundle{i}" in output
+        assert f"[Bundle{i}] done" in output
+
+
+def test_checker_bundle_result_cache(tmp_path):
+    input_file = tmp_path / "input.xodr"
+    input_file.write_text("first")
+    runs_file = tmp_path / "runs.txt"
+    output_dir = tmp_path / "output"
+    result_file = output_dir / "Bundle.xqar"
+    bundle_script = tmp_path / "bundle.py"
+    bundle_script.write_text(
+        f"open(r'{runs_file}', 'a').write('run')\n"
+        f"open(r'{result_file}', 'w').write("
+        f"open(r'{input_file}').read())\n"
+    )
+    config_file = tmp_path / "config.xml"
+    config_file.write_text(
+        "<Config>\n"
+        f'  <Param name="InputFile" value="{input_file}" />\n'
+        '  <CheckerBundle application="Bundle">\n'
+        '    <Param name="strResultFile" value="Bundle.xqar" />\n'
+        "  </CheckerBundle>\n"
+        "</Config>\n"
+    )
+    checker_bundle = Module(
+        name="Bundle",
+        exec_type="executable",
+        module_type="checker_bundle",
+        exec_command=f'"{sys.executable}" "{bundle_script}"',
+    )
+
+    def run() -> str:
+        output_dir.mkdir(exist_ok=True)
+        if result_file.exists():
+            result_file.unlink()
+        run_checker_bundles(
+            [checker_bundle],
+            str(config_file),
+            str(output_dir),
+            cache_dir=str(tmp_path / "cache"),
+        )
+        return result_file.read_text()
+
+    # The second execution is served from the cache
+    assert run() == "first"
+    assert run() == "first"
+    assert runs_file.read_text() == "run"
+
+    # A changed input file executes the bundle again
+    input_file.write_text("second")
+    assert run() == "second"
+    assert runs_file.read_text() == "runrun"
+
+    # Changed parameters of the bundle execute it again
+    config_file.write_text(
+        config_file.read_text().replace(
+            "</CheckerBundle>",
+            '<Checker checkerId="a" minLevel="3" maxLevel="1" /></CheckerBundle>',
+        )
+    )
+    assert run() == "second"
+    assert runs_file.read_text() == "runrunrun"
+
+
+def test_checker_bundle_result_cache_errors(tmp_path, monkeypatch, capsys):
+    result_file = tmp_path / "Bundle.xqar"
+    input_file = tmp_path / "input.xodr"
+    input_file.write_text("input")
+    config_file = tmp_path / "config.xml"
+    config_file.write_text(
+        "<Config>\n"
+        f'  <Param name="InputFile" value="{input_file}" />\n'
+        '  <CheckerBundle application="Bundle">\n'
+        '    <Param name="strResultFile" value="Bundle.xqar" />\n'
+        "  </CheckerBundle>\n"
+        "</Config>\n"
+    )
+    checker_bundle = Module(
+        name="Bundle",
+        exec_type="executable",
+        module_type="checker_bundle",
+        exec_command=f'"{sys.executable}" -c '
+        f"\"open(r'{result_file}', 'w').write('run')\"",
+    )
+
+    def fail(*args) -> None:
+        raise OSError("cache not accessible")
+
+    # A cache which cannot be read or written only prints warnings
+    monkeypatch.setattr(runtime.runtime.cache, "restore_result", fail)
+    monkeypatch.setattr(runtime.runtime.cache, "store_result", fail)
+
+    run_checker_bundles(
+        [checker_bundle],
+        str(config_file),
+        str(tmp_path),
+        cache_dir=str(tmp_path / "cache"),
+    )
+
+    assert result_file.read_text() == "run"
+    output = capsys.readouterr().out
+    assert "Result not restored from cache: cache not accessible" in output
+    assert "Result not stored in cache: cache not accessible" in output
@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/c_logger.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// Size of the buffered output after which it is written
+const std::size_t LOG_BUFFER_SIZE = 64 * 1024;
+
+const char cLogger::ENV_LOG_LEVEL[] = "ASAM_QC_FRAMEWORK_LOG_LEVEL";
+
+// Returns true if a stream is written to a terminal
+static bool IsTerminal(FILE *stream)
+{
+#ifdef WIN32
+    return _isatty(_fileno(stream)) != 0;
+#else
+    return isatty(fileno(stream)) != 0;
+#endif
+}
+
+cLogger &cLogger::GetInstance()
+{
+    static cLogger logger;
+    return logger;
+}
+
+eLogLevel cLogger::GetLogLevelFromStr(const std::string &strLevel, eLogLevel defaultLevel)
+{
+    std::string strLowerLevel = strLevel;
+    std::transform(strLowerLevel.begin(), strLowerLevel.end(), strLowerLevel.begin(),
+                   [](unsigned char c) { return (char)std::tolower(c); });
+
+    if (strLowerLevel == "error")
+        return LOG_ERROR_LVL;
+    if (strLowerLevel == "warning")
+        return LOG_WARNING_LVL;
+    if (strLowerLevel == "info")
+        return LOG_INFO_LVL;
+    if (strLowerLevel == "debug")
+        return LOG_DEBUG_LVL;
+
+    return defaultLevel;
+}
+
+cLogger::cLogger()
+    : m_Level(LOG_INFO_LVL), m_CategoryLimit(DEFAULT_CATEGORY_LIMIT), m_IsOutTerminal(IsTerminal(stdout)),
+      m_IsErrorTerminal(IsTerminal(stderr))
+{
+    std::memset(m_MessageCount, 0, sizeof(m_MessageCount));
+
+    const char *envLevel = std::getenv(ENV_LOG_LEVEL);
+    if (envLevel != nullptr)
+        m_Level = GetLogLevelFromStr(envLevel, LOG_INFO_LVL);
+}
+
+cLogger::~cLogger()
+{
+    Flush();
+}
+
+void cLogger::SetLevel(eLogLevel level)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Level = level;
+}
+
+eLogLevel cLogger::GetLevel() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Level;
+}
+
+bool cLogger::IsEnabled(eLogLevel level) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return level <= m_Level;
+}
+
+void cLogger::SetCategoryLimit(unsigned int limit)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_CategoryLimit = limit;
+}
+
+void cLogger::Log(eLogLevel level, const std::string &strMessage, const char *category)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (level >= LOG_ERROR_LVL && level <= LOG_DEBUG_LVL)
+        m_MessageCount[level]++;
+
+    if (level > m_Level)
+        return;
+
+    if (category != nullptr && ++m_CategoryCount[category] > m_CategoryLimit && m_CategoryLimit != 0)
+        return;
+
+    Write(level, strMessage + "\n");
+}
+
+void cLogger::Flush()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    FlushBuffer(false);
+    FlushBuffer(true);
+}
+
+void cLogger::WriteSummary()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    for (const auto &category : m_CategoryCount)
+    {
+        if (m_CategoryLimit != 0 && category.second > m_CategoryLimit)
+        {
+            Write(LOG_WARNING_LVL, "Suppressed " + std::to_string(category.second - m_CategoryLimit) +
+                                       " further messages of category '" + category.first + "'.\n");
+        }
+    }
+
+    if (m_MessageCount[LOG_ERROR_LVL] > 0 || m_MessageCount[LOG_WARNING_LVL] > 0)
+    {
+        Write(LOG_WARNING_LVL, "Logged " + std::to_string(m_MessageCount[LOG_ERROR_LVL]) + " errors and " +
+                                   std::to_string(m_MessageCount[LOG_WARNING_LVL]) + " warnings.\n");
+    }
+
+    FlushBuffer(false);
+    FlushBuffer(true);
+}
+
+unsigned int cLogger::GetMessageCount(eLogLevel level) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return (level >= LOG_ERROR_LVL && level <= LOG_DEBUG_LVL) ? m_MessageCount[level] : 0;
+}
+
+unsigned int cLogger::GetSuppressedCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    unsigned int suppressedCount = 0;
+    for (const auto &category : m_CategoryCount)
+    {
+        if (m_CategoryLimit != 0 && category.second > m_CategoryLimit)
+            suppressedCount += category.second - m_CategoryLimit;
+    }
+    return suppressedCount;
+}
+
+void cLogger::Write(eLogLevel level, const std::string &strText)
+{
+    const bool toErrorStream = level <= LOG_WARNING_LVL;
+    std::string &buffer = toErrorStream ? m_ErrorBuffer : m_OutBuffer;
+    buffer += strText;
+
+    // Errors are never held back. On a terminal the user watches the progress, so everything above debug is shown
+    // at once as well.
+    const bool isTerminal = toErrorStream ? m_IsErrorTerminal : m_IsOutTerminal;
+    if (level == LOG_ERROR_LVL || (isTerminal && level <= LOG_INFO_LVL))
+    {
+        // Keeps the order of the messages if both streams end up in the same terminal or file. A redirected stdout
+        // is only written early for errors, so its buffering is kept while stderr is shown on a terminal.
+        if (level == LOG_ERROR_LVL || (m_IsOutTerminal && m_IsErrorTerminal))
+            FlushBuffer(!toErrorStream);
+        FlushBuffer(toErrorStream);
+    }
+    else if (buffer.size() >= LOG_BUFFER_SIZE)
+    {
+        FlushBuffer(toErrorStream);
+    }
+}
+
+void cLogger::FlushBuffer(bool errorStream)
+{
+    std::string &buffer = errorStream ? m_ErrorBuffer : m_OutBuffer;
+    if (buffer.empty())
+        return;
+
+    std::ostream &stream = errorStream ? std::cerr : std::cout;
+    stream.write(buffer.data(), (std::streamsize)buffer.size());
+    stream.flush();
+    buffer.clear();
+}
+
+cLogMessage::cLogMessage(eLogLevel level, const char *category)
+    : m_Level(level), m_Category(category), m_Enabled(cLogger::GetInstance().IsEnabled(level))
+{
+}
+
+cLogMessage::~cLogMessage()
+{
+    // Disabled messages are still counted for the summary
+    cLogger::GetInstance().Log(m_Level, m_Enabled ? m_Stream.str() : std::string(), m_Category);
+}
+
+cLogMessage LogError(const char *category)
+{
+    return cLogMessage(LOG_ERROR_LVL, category);
+}
+
+cLogMessage LogWarning(const char *category)
+{
+    return cLogMessage(LOG_WARNING_LVL, category);
+}
+
+cLogMessage LogInfo(const char *category)
+{
+    return cLogMessage(LOG_INFO_LVL, category);
+}
+
+cLogMessage LogDebug(const char *category)
+{
+    return cLogMessage(LOG_DEBUG_LVL, category);
+}
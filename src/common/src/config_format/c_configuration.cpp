@@ -12,6 +12,7 @@
 
 #include "common/config_format/c_configuration_checker_bundle.h"
 #include "common/config_format/c_configuration_report_module.h"
+#include "common/c_logger.h"
 
 XERCES_CPP_NAMESPACE_USE
 const XMLCh *cConfiguration::TAG_CONFIGURATION = CONST_XMLCH("Config");
@@ -47,7 +48,7 @@ bool cConfiguration::ParseFromXML(cConfiguration *config, const std::string &con
         // Parse Root
         if (nullptr == pRoot)
         {
-            std::cout << "Could not get root node of document " << configFilePath << ". Aborting." << std::endl;
+            LogError() << "Could not get root node of document " << configFilePath << ". Aborting.";
             return false;
         }
         DOMNodeList *pChildList = pRoot->getChildNodes();
@@ -65,7 +66,7 @@ bool cConfiguration::ParseFromXML(cConfiguration *config, const std::string &con
     }
     catch (std::exception e)
     {
-        std::cerr << "Error parsing file: " << e.what() << std::flush << std::endl;
+        LogError() << "Error parsing file: " << e.what();
         delete pDomParser;
         return false;
     }
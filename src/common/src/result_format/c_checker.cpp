@@ -9,6 +9,9 @@
  */
 #include "common/result_format/c_checker.h"
 #include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_issue_baseline.h"
+#include "common/result_format/c_issue_fingerprint.h"
+#include "common/result_format/c_result_container.h"
 
 const XMLCh *cChecker::TAG_CHECKER = CONST_XMLCH("Checker");
 const XMLCh *cChecker::ATTR_CHECKER_ID = CONST_XMLCH("checkerId");
@@ -119,6 +122,10 @@ cChecker *cChecker::ParseFromXML(DOMNode *pXMLNode, DOMElement *pXMLElement, cCh
     cChecker *pChecker = new cChecker(strCheckerId, strDescription, strSummary, strStatus);
     pChecker->AssignCheckerBundle(checkerBundle);
 
+    // Issues of the baseline are suppressed before their locations are parsed
+    const cResultContainer *container = (nullptr != checkerBundle) ? checkerBundle->GetResultContainer() : nullptr;
+    cIssueBaseline *baseline = (nullptr != container) ? container->GetBaseline() : nullptr;
+
     DOMNodeList *pIssueChildList = pXMLNode->getChildNodes();
     const XMLSize_t issueNodeCount = pIssueChildList->getLength();
 
@@ -142,10 +149,26 @@ cChecker *cChecker::ParseFromXML(DOMNode *pXMLNode, DOMElement *pXMLElement, cCh
             // Parse Issue
             if (Equals(currentTagName, XMLString::transcode(cIssue::TAG_ISSUE)))
             {
-                cIssue *issueInstance = cIssue::ParseFromXML(currentIssueNode, currentIssueElement, pChecker);
+                bool suppressed = false;
+                if (nullptr != baseline && baseline->GetCount() > 0)
+                {
+                    suppressed = baseline->Contains(cIssueFingerprint::ComputeFromXML(
+                        checkerBundle->GetBundleName(), strCheckerId, currentIssueNode, currentIssueElement));
+                    if (suppressed)
+                        baseline->CountSuppressed();
+                }
 
-                if (issueInstance != nullptr)
-                    pChecker->AddIssue(issueInstance);
+                if (!suppressed || baseline->GetMode() != BASELINE_DROP)
+                {
+                    cIssue *issueInstance = cIssue::ParseFromXML(currentIssueNode, currentIssueElement, pChecker);
+
+                    if (issueInstance != nullptr)
+                    {
+                        pChecker->AddIssue(issueInstance);
+                        if (suppressed)
+                            issueInstance->SetEnabled(false);
+                    }
+                }
             }
 
             // Parse Metadata
@@ -219,6 +242,7 @@ cIssue *cChecker::AddIssue(cIssue *const issueToAdd)
         issueToAdd->SetIssueId(issueToAdd->NextFreeId());
 
         m_Issues.push_back(issueToAdd);
+        CountIssue(issueToAdd, true);
 
         return issueToAdd;
     }
@@ -276,6 +300,12 @@ void cChecker::Clear()
 
     m_Issues.clear();
 
+    if (m_IsCountedInBundle && nullptr != m_Bundle)
+        m_Bundle->m_IssueCounter.Remove(m_IssueCounter);
+    m_IssueCounter.Reset();
+
+    InvalidateQueryIndex();
+
     for (std::list<cRule *>::iterator it = m_Rules.begin(); it != m_Rules.end(); it++)
         delete *it;
 
@@ -288,9 +318,15 @@ void cChecker::Clear()
 }
 
 // Counts the Issues
-unsigned int cChecker::GetIssueCount()
+unsigned int cChecker::GetIssueCount() const
 {
-    return (unsigned int)m_Issues.size();
+    return m_IssueCounter.GetCount();
+}
+
+// Counts the Issues with a given level
+unsigned int cChecker::GetIssueCount(eIssueLevel level) const
+{
+    return m_IssueCounter.GetCount(level);
 }
 
 // Returns the checkers
@@ -444,20 +480,109 @@ unsigned long long cChecker::NextFreeId() const
 
 void cChecker::FilterIssues(eIssueLevel minLevel, eIssueLevel maxLevel)
 {
-    m_Issues.remove_if([minLevel, maxLevel](cIssue *item) {
-        return item->GetIssueLevel() > minLevel || item->GetIssueLevel() < maxLevel;
+    m_Issues.remove_if([this, minLevel, maxLevel](cIssue *item) {
+        if (item->GetIssueLevel() > minLevel || item->GetIssueLevel() < maxLevel)
+        {
+            CountIssue(item, false);
+            delete item;
+            return true;
+        }
+        return false;
     });
 }
 
-std::size_t cChecker::GetEnabledIssuesCount()
+std::size_t cChecker::GetEnabledIssuesCount() const
+{
+    return m_IssueCounter.GetEnabledCount();
+}
+
+std::size_t cChecker::GetEnabledIssuesCount(eIssueLevel level) const
+{
+    return m_IssueCounter.GetEnabledCount(level);
+}
+
+const cIssueCounter &cChecker::GetIssueCounter() const
+{
+    return m_IssueCounter;
+}
+
+void cChecker::CountIssue(const cIssue *issue, bool add)
 {
-    std::size_t enabled_issues_count = 0;
-    for (const auto &itIssue : m_Issues)
+    if (m_DefersUpdates)
+        return;
+
+    cIssueCounter *bundleCounter = (m_IsCountedInBundle && nullptr != m_Bundle) ? &m_Bundle->m_IssueCounter : nullptr;
+
+    if (add)
     {
-        if (itIssue->IsEnabled())
-        {
-            enabled_issues_count++;
-        }
+        m_IssueCounter.Add(issue->GetIssueLevel(), issue->IsEnabled());
+        if (nullptr != bundleCounter)
+            bundleCounter->Add(issue->GetIssueLevel(), issue->IsEnabled());
+    }
+    else
+    {
+        m_IssueCounter.Remove(issue->GetIssueLevel(), issue->IsEnabled());
+        if (nullptr != bundleCounter)
+            bundleCounter->Remove(issue->GetIssueLevel(), issue->IsEnabled());
     }
-    return enabled_issues_count;
+
+    InvalidateQueryIndex();
+}
+
+void cChecker::OnIssueEnabledChanged(const cIssue *issue)
+{
+    if (m_DefersUpdates)
+        return;
+
+    m_IssueCounter.SetEnabled(issue->GetIssueLevel(), issue->IsEnabled());
+    if (m_IsCountedInBundle && nullptr != m_Bundle)
+        m_Bundle->m_IssueCounter.SetEnabled(issue->GetIssueLevel(), issue->IsEnabled());
+}
+
+void cChecker::OnIssueLevelChanged(const cIssue *issue, eIssueLevel oldLevel)
+{
+    if (m_DefersUpdates)
+        return;
+
+    m_IssueCounter.Remove(oldLevel, issue->IsEnabled());
+    m_IssueCounter.Add(issue->GetIssueLevel(), issue->IsEnabled());
+    if (m_IsCountedInBundle && nullptr != m_Bundle)
+    {
+        m_Bundle->m_IssueCounter.Remove(oldLevel, issue->IsEnabled());
+        m_Bundle->m_IssueCounter.Add(issue->GetIssueLevel(), issue->IsEnabled());
+    }
+
+    InvalidateQueryIndex();
+}
+
+void cChecker::InvalidateQueryIndex() const
+{
+    if (m_DefersUpdates)
+        return;
+
+    if (nullptr != m_Bundle && nullptr != m_Bundle->m_Container)
+        m_Bundle->m_Container->InvalidateQueryIndex();
+}
+
+void cChecker::BeginDeferredUpdates()
+{
+    m_DefersUpdates = true;
+}
+
+void cChecker::EndDeferredUpdates()
+{
+    m_DefersUpdates = false;
+
+    cIssueCounter counter;
+    for (const cIssue *issue : m_Issues)
+        counter.Add(issue->GetIssueLevel(), issue->IsEnabled());
+
+    if (m_IsCountedInBundle && nullptr != m_Bundle)
+    {
+        m_Bundle->m_IssueCounter.Remove(m_IssueCounter);
+        m_Bundle->m_IssueCounter.Add(counter);
+    }
+    m_IssueCounter = counter;
+
+    InvalidateQueryIndex();
 }
@@ -24,7 +24,7 @@ const XMLCh *cCheckerBundle::ATTR_BUILD_VERSION = CONST_XMLCH("version");
 
 cCheckerBundle::cCheckerBundle(const std::string &checkerName, const std::string &checkerSummary,
                                const std::string &description)
-    : m_CheckerName(checkerName), m_CheckerSummary(checkerSummary), m_Description(description)
+    : m_CheckerName(checkerName), m_CheckerSummary(checkerSummary), m_Description(description), m_Container(nullptr)
 {
     m_BuildDate = BUILD_DATE;
     m_BuildVersion = BUILD_VERSION;
@@ -149,6 +149,16 @@ cChecker *cCheckerBundle::CreateChecker(cChecker *newChecker)
 
     newChecker->AssignCheckerBundle(this);
     m_Checkers.push_back(newChecker);
+
+    if (nullptr != m_Container)
+        m_Container->InvalidateQueryIndex();
+
+    // Issues may have been added before the checker was added to the bundle
+    if (!newChecker->m_IsCountedInBundle)
+    {
+        m_IssueCounter.Add(newChecker->m_IssueCounter);
+        newChecker->m_IsCountedInBundle = true;
+    }
     return newChecker;
 }
 
@@ -169,12 +179,19 @@ void cCheckerBundle::Clear()
     }
 
     m_Checkers.clear();
+    m_IssueCounter.Reset();
+
+    if (nullptr != m_Container)
+        m_Container->InvalidateQueryIndex();
 }
 
 // Sets the name
 void cCheckerBundle::SetName(const std::string &strName)
 {
     m_CheckerName = strName;
+
+    if (nullptr != m_Container)
+        m_Container->InvalidateQueryIndex();
 }
 
 // Sets the summary
@@ -247,12 +264,13 @@ std::string cCheckerBundle::GetDescription() const
 // Counts the Issues
 unsigned int cCheckerBundle::GetIssueCount() const
 {
-    unsigned int result = 0;
-
-    for (std::list<cChecker *>::const_iterator it = m_Checkers.begin(); it != m_Checkers.end(); it++)
-        result += (*it)->GetIssueCount();
+    return m_IssueCounter.GetCount();
+}
 
-    return result;
+// Counts the Issues with a given level
+unsigned int cCheckerBundle::GetIssueCount(eIssueLevel level) const
+{
+    return m_IssueCounter.GetCount(level);
 }
 
 // Counts the Checkers
@@ -469,18 +487,33 @@ void cCheckerBundle::KeepCheckersFrom(const std::vector<std::string> &checkerIds
 
     // Use remove_if and erase to filter the items based on the names
     m_Checkers.erase(std::remove_if(m_Checkers.begin(), m_Checkers.end(),
-                                    [&checkerSet](cChecker *item) {
-                                        return checkerSet.find(item->GetCheckerID()) == checkerSet.end();
+                                    [this, &checkerSet](cChecker *item) {
+                                        if (checkerSet.find(item->GetCheckerID()) != checkerSet.end())
+                                            return false;
+
+                                        m_IssueCounter.Remove(item->m_IssueCounter);
+                                        item->m_IsCountedInBundle = false;
+                                        item->Clear();
+                                        delete item;
+                                        return true;
                                     }),
                      m_Checkers.end());
+
+    if (nullptr != m_Container)
+        m_Container->InvalidateQueryIndex();
 }
 
-std::size_t cCheckerBundle::GetEnabledIssuesCount()
+std::size_t cCheckerBundle::GetEnabledIssuesCount() const
 {
-    std::size_t total_enabled_issues = 0;
-    for (const auto &itChecker : m_Checkers)
-    {
-        total_enabled_issues += itChecker->GetEnabledIssuesCount();
-    }
-    return total_enabled_issues;
+    return m_IssueCounter.GetEnabledCount();
+}
+
+std::size_t cCheckerBundle::GetEnabledIssuesCount(eIssueLevel level) const
+{
+    return m_IssueCounter.GetEnabledCount(level);
+}
+
+const cIssueCounter &cCheckerBundle::GetIssueCounter() const
+{
+    return m_IssueCounter;
 }
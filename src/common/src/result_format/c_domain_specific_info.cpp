@@ -7,9 +7,11 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 #include "common/result_format/c_domain_specific_info.h"
-#include <iostream>
+#include "common/c_logger.h"
+#include <memory>
 #include <string>
 #include <xercesc/dom/DOM.hpp>
+#include <xercesc/framework/MemBufFormatTarget.hpp>
 #include <xercesc/framework/MemBufInputSource.hpp>
 #include <xercesc/parsers/XercesDOMParser.hpp>
 #include <xercesc/sax/SAXParseException.hpp>
@@ -17,45 +19,200 @@
 
 const XMLCh *cDomainSpecificInfo::TAG_DOMAIN_SPECIFIC_INFO = CONST_XMLCH("DomainSpecificInfo");
 const XMLCh *cDomainSpecificInfo::ATTR_NAME = CONST_XMLCH("name");
+
+// Parser of the innermost cParserScope of the current thread
+static thread_local XercesDOMParser *s_ScopeParser = nullptr;
+
+// Serializes an element and its children into an UTF-8 fragment without xml declaration
+static std::string SerializeElement(const DOMElement *element)
+{
+    DOMImplementation *p_DOMImplementationLS = DOMImplementationRegistry::getDOMImplementation(CONST_XMLCH("LS"));
+    DOMLSSerializer *p_DOMSerializer = ((DOMImplementationLS *)p_DOMImplementationLS)->createLSSerializer();
+
+    DOMConfiguration *p_DOMConfig = p_DOMSerializer->getDomConfig();
+    if (p_DOMConfig->canSetParameter(XMLUni::fgDOMXMLDeclaration, false))
+        p_DOMConfig->setParameter(XMLUni::fgDOMXMLDeclaration, false);
+
+    MemBufFormatTarget target;
+    DOMLSOutput *pDomLsOutput = ((DOMImplementationLS *)p_DOMImplementationLS)->createLSOutput();
+    pDomLsOutput->setEncoding(XMLUni::fgUTF8EncodingString);
+    pDomLsOutput->setByteStream(&target);
+
+    p_DOMSerializer->write(element, pDomLsOutput);
+
+    std::string fragment(reinterpret_cast<const char *>(target.getRawBuffer()), target.getLen());
+
+    pDomLsOutput->release();
+    p_DOMSerializer->release();
+
+    return fragment;
+}
+
+cDomainSpecificInfo::cDomainSpecificInfo(DOMElement *inputRoot, const std::string &name)
+    : m_Root(nullptr), m_Doc(nullptr), m_Name(name)
+{
+    if (nullptr != inputRoot)
+        m_Fragment = SerializeElement(inputRoot);
+}
+
+cDomainSpecificInfo::cDomainSpecificInfo(const std::string &fragment, const std::string &name)
+    : m_Root(nullptr), m_Doc(nullptr), m_Fragment(fragment), m_Name(name)
+{
+}
+
+// Converts the message of a Xerces exception
+static std::string TranscodeMessage(const XMLCh *message)
+{
+    if (nullptr == message)
+        return std::string();
+
+    char *pMessage = XMLString::transcode(message);
+    std::string strMessage = pMessage;
+    XMLString::release(&pMessage);
+    return strMessage;
+}
+
+// Creates a parser for fragments, which never loads external files
+static XercesDOMParser *CreateFragmentParser()
+{
+    XercesDOMParser *parser = new XercesDOMParser();
+    parser->setValidationScheme(XercesDOMParser::Val_Never);
+    parser->setDoNamespaces(false);
+    parser->setDoSchema(false);
+    parser->setLoadExternalDTD(false);
+    return parser;
+}
+
+cDomainSpecificInfo::cParserScope::cParserScope()
+    : m_Parser(CreateFragmentParser()), m_PreviousParser(s_ScopeParser)
+{
+    s_ScopeParser = m_Parser;
+}
+
+cDomainSpecificInfo::cParserScope::~cParserScope()
+{
+    s_ScopeParser = m_PreviousParser;
+    delete m_Parser;
+}
+
+DOMDocument *cDomainSpecificInfo::ParseFragment() const
+{
+    if (m_Fragment.empty())
+        return nullptr;
+
+    std::unique_ptr<XercesDOMParser> ownParser;
+    XercesDOMParser *parser = s_ScopeParser;
+    if (nullptr == parser)
+    {
+        ownParser.reset(CreateFragmentParser());
+        parser = ownParser.get();
+    }
+
+    MemBufInputSource source(reinterpret_cast<const XMLByte *>(m_Fragment.c_str()), m_Fragment.length(),
+                             "DomainSpecificInfo");
+    bool success = false;
+    std::string strError;
+    try
+    {
+        parser->parse(source);
+        success = true;
+    }
+    catch (const XMLException &e)
+    {
+        strError = TranscodeMessage(e.getMessage());
+    }
+    catch (const SAXParseException &e)
+    {
+        strError = TranscodeMessage(e.getMessage());
+    }
+    catch (const DOMException &e)
+    {
+        strError = TranscodeMessage(e.getMessage());
+    }
+
+    if (!success)
+    {
+        LogWarning("Invalid domain specific info")
+            << "Could not parse domain specific info '" << m_Name << "': " << strError;
+        // Drop the partial document, a shared parser would keep it until the scope ends
+        parser->resetDocumentPool();
+        return nullptr;
+    }
+
+    // The document is owned by the caller from now on
+    return parser->adoptDocument();
+}
+
 // Returns the root
 DOMElement *cDomainSpecificInfo::GetRoot() const
 {
+    if (nullptr == m_Doc)
+    {
+        m_Doc = ParseFragment();
+        if (nullptr != m_Doc)
+            m_Root = m_Doc->getDocumentElement();
+    }
     return m_Root;
 }
 DOMDocument *cDomainSpecificInfo::GetDoc() const
 {
+    GetRoot();
     return m_Doc;
 }
 std::string cDomainSpecificInfo::GetName() const
 {
     return m_Name;
 }
+const std::string &cDomainSpecificInfo::GetFragment() const
+{
+    return m_Fragment;
+}
+bool cDomainSpecificInfo::IsMaterialized() const
+{
+    return nullptr != m_Doc;
+}
 
 cDomainSpecificInfo::~cDomainSpecificInfo()
 {
-    m_Doc->release();
+    if (nullptr != m_Doc)
+        m_Doc->release();
 }
 
 DOMElement *cDomainSpecificInfo::WriteXML(DOMDocument *p_resultDocument)
 {
-    DOMElement *p_DataElement = p_resultDocument->createElement(TAG_DOMAIN_SPECIFIC_INFO);
-    XMLCh *pName = XMLString::transcode(m_Name.c_str());
-    p_DataElement->setAttribute(ATTR_NAME, pName);
+    // Reuse an already created DOM, otherwise parse the fragment only for the duration of the import
+    DOMDocument *pSourceDoc = m_Doc;
+    if (nullptr == pSourceDoc)
+        pSourceDoc = ParseFragment();
 
-    // Import the root element from the original document to the new document
-    DOMElement *importedRootElement = (DOMElement *)p_resultDocument->importNode(m_Root, true);
-    // Append the imported root element to the new document
-    p_DataElement->appendChild(importedRootElement);
-    // Return the appended root element
+    if (nullptr == pSourceDoc || nullptr == pSourceDoc->getDocumentElement())
+    {
+        if (nullptr != pSourceDoc && pSourceDoc != m_Doc)
+            pSourceDoc->release();
 
-    XMLString::release(&pName);
+        // Write at least an empty info to keep the issue valid
+        DOMElement *p_DataElement = p_resultDocument->createElement(TAG_DOMAIN_SPECIFIC_INFO);
+        XMLCh *pName = XMLString::transcode(m_Name.c_str());
+        p_DataElement->setAttribute(ATTR_NAME, pName);
+        XMLString::release(&pName);
+        return p_DataElement;
+    }
+
+    // Import the root element from the fragment document to the result document
+    DOMElement *importedRootElement =
+        (DOMElement *)p_resultDocument->importNode(pSourceDoc->getDocumentElement(), true);
+
+    if (pSourceDoc != m_Doc)
+        pSourceDoc->release();
 
     return importedRootElement;
 }
 
 cDomainSpecificInfo *cDomainSpecificInfo::ParseFromXML(DOMNode *pXMLNode, DOMElement *pXMLElement)
 {
-    std::string strName = XMLString::transcode(pXMLElement->getAttribute(ATTR_NAME));
+    char *pName = XMLString::transcode(pXMLElement->getAttribute(ATTR_NAME));
+    std::string strName = pName;
+    XMLString::release(&pName);
 
     cDomainSpecificInfo *domainInfo = new cDomainSpecificInfo(pXMLElement, strName);
     // Return the parsed instance
@@ -75,6 +75,9 @@ void cIssue::AddLocationsContainer(cLocationsContainer *locationsContainer)
 {
     if (nullptr != locationsContainer)
         m_Locations.push_back(locationsContainer);
+
+    if (nullptr != m_Checker)
+        m_Checker->InvalidateQueryIndex();
 }
 
 void cIssue::AddDomainSpecificInfo(cDomainSpecificInfo *domainSpecificInfo)
@@ -86,6 +89,9 @@ void cIssue::AddDomainSpecificInfo(cDomainSpecificInfo *domainSpecificInfo)
 void cIssue::AddLocationsContainer(std::list<cLocationsContainer *> listLoc)
 {
     m_Locations.insert(m_Locations.end(), listLoc.begin(), listLoc.end());
+
+    if (nullptr != m_Checker)
+        m_Checker->InvalidateQueryIndex();
 }
 
 void cIssue::AddDomainSpecificInfo(std::list<cDomainSpecificInfo *> listDomainSpecificInfo)
@@ -270,11 +276,21 @@ void cIssue::SetDescription(const std::string &strDescription)
 void cIssue::SetRuleUID(const std::string &strRuleUID)
 {
     m_RuleUID = strRuleUID;
+
+    if (nullptr != m_Checker)
+        m_Checker->InvalidateQueryIndex();
 }
 
 void cIssue::SetLevel(eIssueLevel level)
 {
+    if (level == m_IssueLevel)
+        return;
+
+    eIssueLevel oldLevel = m_IssueLevel;
     m_IssueLevel = level;
+
+    if (nullptr != m_Checker)
+        m_Checker->OnIssueLevelChanged(this, oldLevel);
 }
 
 // Returns the description
@@ -366,5 +382,11 @@ bool cIssue::IsEnabled() const
 
 void cIssue::SetEnabled(bool inValue)
 {
+    if (inValue == m_Enabled)
+        return;
+
     m_Enabled = inValue;
+
+    if (nullptr != m_Checker)
+        m_Checker->OnIssueEnabledChanged(this);
 }
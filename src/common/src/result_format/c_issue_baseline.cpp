@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/result_format/c_issue_baseline.h"
+
+#include "common/c_logger.h"
+#include "common/result_format/c_issue_fingerprint.h"
+#include "common/util.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+cIssueBaseline::cIssueBaseline(eBaselineMode mode) : m_Mode(mode), m_SuppressedCount(0)
+{
+}
+
+bool cIssueBaseline::LoadFromFile(const std::string &strFilePath)
+{
+    std::ifstream inFile(strFilePath);
+    if (!inFile.is_open())
+    {
+        LogError() << "Could not read baseline file '" << strFilePath << "'!";
+        return false;
+    }
+
+    std::string strLine;
+    unsigned int lineNumber = 0;
+    while (std::getline(inFile, strLine))
+    {
+        lineNumber++;
+
+        // Ignore surrounding whitespace and carriage returns of files written on windows
+        const std::size_t begin = strLine.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || strLine[begin] == '#')
+            continue;
+        const std::size_t end = strLine.find_last_not_of(" \t\r");
+
+        uint64_t fingerprint = 0;
+        if (cIssueFingerprint::FromString(strLine.substr(begin, end - begin + 1), fingerprint))
+            m_Fingerprints.insert(fingerprint);
+        else
+            LogWarning("Invalid fingerprint") << "Invalid fingerprint in baseline file '" << strFilePath << "' at line "
+                                              << lineNumber << ". Skipping...";
+    }
+
+    return true;
+}
+
+bool cIssueBaseline::WriteToFile(const std::string &strFilePath) const
+{
+    std::ofstream outFile(strFilePath);
+    if (!outFile.is_open())
+    {
+        LogError() << "Could not write baseline file '" << strFilePath << "'!";
+        return false;
+    }
+
+    // Sorted, so the files of equal baselines are equal and diff well
+    std::vector<uint64_t> fingerprints(m_Fingerprints.begin(), m_Fingerprints.end());
+    std::sort(fingerprints.begin(), fingerprints.end());
+
+    outFile << "# Issue fingerprints of accepted issues\n";
+    for (uint64_t fingerprint : fingerprints)
+        outFile << cIssueFingerprint::ToString(fingerprint) << "\n";
+
+    return outFile.good();
+}
+
+void cIssueBaseline::Add(uint64_t fingerprint)
+{
+    m_Fingerprints.insert(fingerprint);
+}
+
+bool cIssueBaseline::Contains(uint64_t fingerprint) const
+{
+    return m_Fingerprints.find(fingerprint) != m_Fingerprints.end();
+}
+
+std::size_t cIssueBaseline::GetCount() const
+{
+    return m_Fingerprints.size();
+}
+
+eBaselineMode cIssueBaseline::GetMode() const
+{
+    return m_Mode;
+}
+
+void cIssueBaseline::SetMode(eBaselineMode mode)
+{
+    m_Mode = mode;
+}
+
+void cIssueBaseline::CountSuppressed()
+{
+    m_SuppressedCount++;
+}
+
+unsigned int cIssueBaseline::GetSuppressedCount() const
+{
+    return m_SuppressedCount;
+}
+
+bool cIssueBaseline::GetModeFromStr(const std::string &strMode, eBaselineMode *mode)
+{
+    const std::string strLowerMode = ToLower(strMode);
+    if (strLowerMode == "drop")
+        *mode = BASELINE_DROP;
+    else if (strLowerMode == "disable")
+        *mode = BASELINE_DISABLE;
+    else
+        return false;
+
+    return true;
+}
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/result_format/c_issue_counter.h"
+
+cIssueCounter::cIssueCounter()
+{
+    Reset();
+}
+
+int cIssueCounter::GetSlot(eIssueLevel level)
+{
+    if (level >= ERROR_LVL && level <= INFO_LVL)
+        return (int)level;
+
+    return 0;
+}
+
+void cIssueCounter::Add(eIssueLevel level, bool enabled)
+{
+    const int slot = GetSlot(level);
+
+    m_Count[0]++;
+    if (slot != 0)
+        m_Count[slot]++;
+
+    if (enabled)
+    {
+        m_EnabledCount[0]++;
+        if (slot != 0)
+            m_EnabledCount[slot]++;
+    }
+}
+
+void cIssueCounter::Remove(eIssueLevel level, bool enabled)
+{
+    const int slot = GetSlot(level);
+
+    m_Count[0]--;
+    if (slot != 0)
+        m_Count[slot]--;
+
+    if (enabled)
+    {
+        m_EnabledCount[0]--;
+        if (slot != 0)
+            m_EnabledCount[slot]--;
+    }
+}
+
+void cIssueCounter::SetEnabled(eIssueLevel level, bool enabled)
+{
+    const int slot = GetSlot(level);
+
+    if (enabled)
+    {
+        m_EnabledCount[0]++;
+        if (slot != 0)
+            m_EnabledCount[slot]++;
+    }
+    else
+    {
+        m_EnabledCount[0]--;
+        if (slot != 0)
+            m_EnabledCount[slot]--;
+    }
+}
+
+void cIssueCounter::Add(const cIssueCounter &other)
+{
+    for (int i = 0; i < COUNT_SLOTS; i++)
+    {
+        m_Count[i] += other.m_Count[i];
+        m_EnabledCount[i] += other.m_EnabledCount[i];
+    }
+}
+
+void cIssueCounter::Remove(const cIssueCounter &other)
+{
+    for (int i = 0; i < COUNT_SLOTS; i++)
+    {
+        m_Count[i] -= other.m_Count[i];
+        m_EnabledCount[i] -= other.m_EnabledCount[i];
+    }
+}
+
+void cIssueCounter::Reset()
+{
+    for (int i = 0; i < COUNT_SLOTS; i++)
+    {
+        m_Count[i] = 0;
+        m_EnabledCount[i] = 0;
+    }
+}
+
+unsigned int cIssueCounter::GetCount() const
+{
+    return m_Count[0];
+}
+
+unsigned int cIssueCounter::GetCount(eIssueLevel level) const
+{
+    const int slot = GetSlot(level);
+    return (slot != 0) ? m_Count[slot] : 0;
+}
+
+unsigned int cIssueCounter::GetEnabledCount() const
+{
+    return m_EnabledCount[0];
+}
+
+unsigned int cIssueCounter::GetEnabledCount(eIssueLevel level) const
+{
+    const int slot = GetSlot(level);
+    return (slot != 0) ? m_EnabledCount[slot] : 0;
+}
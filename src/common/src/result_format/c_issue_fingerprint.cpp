@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/result_format/c_issue_fingerprint.h"
+
+#include "common/result_format/c_checker.h"
+#include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_inertial_location.h"
+#include "common/result_format/c_locations_container.h"
+#include "common/result_format/c_message_location.h"
+#include "common/result_format/c_time_location.h"
+#include "common/result_format/c_xml_location.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+XERCES_CPP_NAMESPACE_USE
+
+// FNV-1a 64 bit parameters
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+// Returns the value of an attribute as string
+static std::string GetAttribute(DOMElement *pXMLElement, const XMLCh *attribute)
+{
+    char *pValue = XMLString::transcode(pXMLElement->getAttribute(attribute));
+    std::string result(pValue);
+    XMLString::release(&pValue);
+    return result;
+}
+
+// Tags which separate the different kinds of values in the hash
+enum eFingerprintTag
+{
+    TAG_XPATH = 1,
+    TAG_INERTIAL = 2,
+    TAG_TIME = 3,
+    TAG_MESSAGE = 4
+};
+
+cIssueFingerprint::cIssueFingerprint() : m_Hash(FNV_OFFSET_BASIS)
+{
+}
+
+void cIssueFingerprint::AddIssue(const std::string &bundleName, const std::string &checkerID,
+                                 const std::string &ruleUID, eIssueLevel level, const std::string &description)
+{
+    AddString(bundleName);
+    AddString(checkerID);
+    AddString(ruleUID);
+    AddNumber((uint64_t)level);
+    AddString(NormalizeDescription(description));
+}
+
+void cIssueFingerprint::AddXPath(const std::string &xpath)
+{
+    AddNumber(TAG_XPATH);
+    AddString(xpath);
+}
+
+void cIssueFingerprint::AddInertial(double x, double y, double z)
+{
+    AddNumber(TAG_INERTIAL);
+    AddDouble(x);
+    AddDouble(y);
+    AddDouble(z);
+}
+
+void cIssueFingerprint::AddTime(double time)
+{
+    AddNumber(TAG_TIME);
+    AddDouble(time);
+}
+
+void cIssueFingerprint::AddMessage(uint64_t index, const std::optional<std::string> &channel,
+                                   const std::optional<std::string> &field, const std::optional<double> &time)
+{
+    AddNumber(TAG_MESSAGE);
+    AddNumber(index);
+
+    // Presence flags keep a missing value apart from an empty one
+    AddNumber(channel.has_value());
+    if (channel.has_value())
+        AddString(channel.value());
+
+    AddNumber(field.has_value());
+    if (field.has_value())
+        AddString(field.value());
+
+    AddNumber(time.has_value());
+    if (time.has_value())
+        AddDouble(time.value());
+}
+
+uint64_t cIssueFingerprint::GetValue() const
+{
+    return m_Hash;
+}
+
+uint64_t cIssueFingerprint::Compute(const cCheckerBundle *bundle, const cChecker *checker, const cIssue *issue)
+{
+    cIssueFingerprint fingerprint;
+    fingerprint.AddIssue(bundle->GetBundleName(), checker->GetCheckerID(), issue->GetRuleUID(),
+                         issue->GetIssueLevel(), issue->GetDescription());
+
+    for (const cLocationsContainer *location : issue->GetLocationsContainer())
+    {
+        for (cExtendedInformation *extInfo : location->GetExtendedInformations())
+        {
+            if (const cXMLLocation *xmlLocation = dynamic_cast<const cXMLLocation *>(extInfo))
+            {
+                fingerprint.AddXPath(xmlLocation->GetXPath());
+            }
+            else if (const cInertialLocation *inertialLocation = dynamic_cast<const cInertialLocation *>(extInfo))
+            {
+                fingerprint.AddInertial(inertialLocation->GetX(), inertialLocation->GetY(),
+                                        inertialLocation->GetZ());
+            }
+            else if (const cTimeLocation *timeLocation = dynamic_cast<const cTimeLocation *>(extInfo))
+            {
+                fingerprint.AddTime(timeLocation->GetTime());
+            }
+            else if (const cMessageLocation *messageLocation = dynamic_cast<const cMessageLocation *>(extInfo))
+            {
+                fingerprint.AddMessage(messageLocation->GetIndex(), messageLocation->GetChannel(),
+                                       messageLocation->GetField(), messageLocation->GetTime());
+            }
+        }
+    }
+
+    return fingerprint.GetValue();
+}
+
+uint64_t cIssueFingerprint::ComputeFromXML(const std::string &bundleName, const std::string &checkerID,
+                                           DOMNode *pXMLNode, DOMElement *pXMLElement)
+{
+    cIssueFingerprint fingerprint;
+    fingerprint.AddIssue(bundleName, checkerID, GetAttribute(pXMLElement, cIssue::ATTR_RULEUID),
+                         cIssue::GetIssueLevelFromStr(GetAttribute(pXMLElement, cIssue::ATTR_LEVEL)),
+                         GetAttribute(pXMLElement, cIssue::ATTR_DESCRIPTION));
+
+    // Follows the parsing in cIssue::ParseFromXML() and cLocationsContainer::ParseFromXML()
+    DOMNodeList *pIssueChildList = pXMLNode->getChildNodes();
+    const XMLSize_t issueNodeCount = pIssueChildList->getLength();
+    for (XMLSize_t i = 0; i < issueNodeCount; ++i)
+    {
+        DOMNode *pLocationsNode = pIssueChildList->item(i);
+        if (pLocationsNode->getNodeType() != DOMNode::ELEMENT_NODE)
+            continue;
+
+        DOMElement *pLocationsElement = dynamic_cast<DOMElement *>(pLocationsNode);
+        if (!XMLString::equals(pLocationsElement->getTagName(), cLocationsContainer::TAG_LOCATIONS))
+            continue;
+
+        DOMNodeList *pLocationChildList = pLocationsNode->getChildNodes();
+        const XMLSize_t locationNodeCount = pLocationChildList->getLength();
+        for (XMLSize_t j = 0; j < locationNodeCount; ++j)
+        {
+            DOMNode *pLocationNode = pLocationChildList->item(j);
+            if (pLocationNode->getNodeType() != DOMNode::ELEMENT_NODE)
+                continue;
+
+            DOMElement *pLocationElement = dynamic_cast<DOMElement *>(pLocationNode);
+            const XMLCh *tagName = pLocationElement->getTagName();
+
+            if (XMLString::equals(tagName, cXMLLocation::TAG_NAME))
+            {
+                fingerprint.AddXPath(GetAttribute(pLocationElement, cXMLLocation::ATTR_XPATH));
+            }
+            else if (XMLString::equals(tagName, cInertialLocation::TAG_NAME))
+            {
+                fingerprint.AddInertial(atof(GetAttribute(pLocationElement, cInertialLocation::ATTR_X).c_str()),
+                                        atof(GetAttribute(pLocationElement, cInertialLocation::ATTR_Y).c_str()),
+                                        atof(GetAttribute(pLocationElement, cInertialLocation::ATTR_Z).c_str()));
+            }
+            else if (XMLString::equals(tagName, cTimeLocation::TAG_NAME))
+            {
+                if (pLocationElement->hasAttribute(cTimeLocation::ATTR_TIME))
+                    fingerprint.AddTime(atof(GetAttribute(pLocationElement, cTimeLocation::ATTR_TIME).c_str()));
+            }
+            else if (XMLString::equals(tagName, cMessageLocation::TAG_NAME))
+            {
+                if (!pLocationElement->hasAttribute(cMessageLocation::ATTR_INDEX))
+                    continue;
+
+                std::optional<std::string> channel;
+                std::optional<std::string> field;
+                std::optional<double> time;
+
+                if (pLocationElement->hasAttribute(cMessageLocation::ATTR_CHANNEL))
+                    channel = GetAttribute(pLocationElement, cMessageLocation::ATTR_CHANNEL);
+                if (pLocationElement->hasAttribute(cMessageLocation::ATTR_FIELD))
+                    field = GetAttribute(pLocationElement, cMessageLocation::ATTR_FIELD);
+                if (pLocationElement->hasAttribute(cMessageLocation::ATTR_TIME))
+                    time = atof(GetAttribute(pLocationElement, cMessageLocation::ATTR_TIME).c_str());
+
+                fingerprint.AddMessage(atoll(GetAttribute(pLocationElement, cMessageLocation::ATTR_INDEX).c_str()),
+                                       channel, field, time);
+            }
+        }
+    }
+
+    return fingerprint.GetValue();
+}
+
+std::string cIssueFingerprint::NormalizeDescription(const std::string &description)
+{
+    std::size_t begin = 0;
+    while (begin < description.size() && std::isspace((unsigned char)description[begin]))
+        begin++;
+
+    // Skip an issue id prefix as written by the report modules, e.g. "#12: "
+    if (begin < description.size() && description[begin] == '#')
+    {
+        std::size_t pos = begin + 1;
+        while (pos < description.size() && std::isdigit((unsigned char)description[pos]))
+            pos++;
+
+        if (pos > begin + 1 && pos < description.size() && description[pos] == ':')
+        {
+            begin = pos + 1;
+            while (begin < description.size() && std::isspace((unsigned char)description[begin]))
+                begin++;
+        }
+    }
+
+    std::string result;
+    result.reserve(description.size() - begin);
+
+    bool pendingSpace = false;
+    for (std::size_t i = begin; i < description.size(); i++)
+    {
+        const char c = description[i];
+        if (std::isspace((unsigned char)c))
+        {
+            pendingSpace = true;
+            continue;
+        }
+
+        if (pendingSpace && !result.empty())
+            result += ' ';
+
+        pendingSpace = false;
+        result += c;
+    }
+
+    return result;
+}
+
+std::string cIssueFingerprint::ToString(uint64_t fingerprint)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    std::string result(16, '0');
+    for (int i = 15; i >= 0; i--)
+    {
+        result[i] = HEX_DIGITS[fingerprint & 0xF];
+        fingerprint >>= 4;
+    }
+    return result;
+}
+
+bool cIssueFingerprint::FromString(const std::string &strFingerprint, uint64_t &fingerprint)
+{
+    if (strFingerprint.empty() || strFingerprint.size() > 16)
+        return false;
+
+    uint64_t value = 0;
+    for (const char c : strFingerprint)
+    {
+        int digit;
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            digit = c - 'A' + 10;
+        else
+            return false;
+
+        value = (value << 4) | (uint64_t)digit;
+    }
+
+    fingerprint = value;
+    return true;
+}
+
+void cIssueFingerprint::AddBytes(const void *data, std::size_t size)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        m_Hash ^= bytes[i];
+        m_Hash *= FNV_PRIME;
+    }
+}
+
+void cIssueFingerprint::AddString(const std::string &value)
+{
+    AddNumber(value.size());
+    AddBytes(value.data(), value.size());
+}
+
+void cIssueFingerprint::AddNumber(uint64_t value)
+{
+    // Fixed byte order, so fingerprints do not depend on the platform
+    unsigned char bytes[8];
+    for (int i = 0; i < 8; i++)
+        bytes[i] = (unsigned char)((value >> (8 * i)) & 0xFF);
+
+    AddBytes(bytes, sizeof(bytes));
+}
+
+void cIssueFingerprint::AddDouble(double value)
+{
+    // Round to 1e-6, so tiny deviations of the serialized values do not change the fingerprint
+    AddNumber((uint64_t)std::llround(value * 1e6));
+}
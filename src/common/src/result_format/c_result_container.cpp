@@ -8,19 +8,34 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 #include "common/result_format/c_result_container.h"
+#include "common/c_logger.h"
 #include "common/config_format/c_configuration.h"
 #include "common/config_format/c_configuration_checker.h"
 #include "common/config_format/c_configuration_checker_bundle.h"
 #include "common/result_format/c_checker.h"
 #include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_domain_specific_info.h"
 #include "common/result_format/c_issue.h"
+#include "common/result_format/c_result_index.h"
+#include "common/util_parallel.h"
+#include "common/xml/c_progress_input_source.h"
+
+#include <mutex>
 
 XERCES_CPP_NAMESPACE_USE
 
 const XMLCh *cResultContainer::ATTR_VERSION = CONST_XMLCH("version");
 const XMLCh *cResultContainer::XAQR_VERSION = CONST_XMLCH("1.0.0");
 
-cResultContainer::cResultContainer()
+// Query index of a container and the mutex which guards it
+class cResultContainer::cQueryIndexState
+{
+  public:
+    std::unique_ptr<cResultIndex> m_Index;
+    std::mutex m_Mutex;
+};
+
+cResultContainer::cResultContainer() : m_QueryIndex(new cQueryIndexState())
 {
 }
 
@@ -41,6 +56,7 @@ void cResultContainer::AddCheckerBundle(cCheckerBundle *checkerBundle)
     checkerBundle->AssignResultContainer(this);
 
     m_Bundles.push_back(checkerBundle);
+    InvalidateQueryIndex();
 }
 
 /*
@@ -56,6 +72,7 @@ void cResultContainer::Clear()
     }
 
     m_Bundles.clear();
+    InvalidateQueryIndex();
 }
 
 void cResultContainer::WriteResults(const std::string &path) const
@@ -75,6 +92,9 @@ void cResultContainer::WriteResults(const std::string &path) const
     DOMElement *p_RootElement = p_resultDocument->getDocumentElement();
     p_RootElement->setAttribute(ATTR_VERSION, XAQR_VERSION);
 
+    // The fragments of all domain specific infos are imported with one parser
+    cDomainSpecificInfo::cParserScope parserScope;
+
     // Write all Summaries to XML
     for (std::list<cCheckerBundle *>::const_iterator it = m_Bundles.begin(); it != m_Bundles.end(); ++it)
     {
@@ -109,66 +129,117 @@ Adds the results from a already existing XQAR file
 \param strXmlFilePath: Path to a existing QXAR file
 */
 void cResultContainer::AddResultsFromXML(const std::string &strXmlFilePath)
+{
+    AddResultsFromXML(strXmlFilePath, tProgressCallback());
+}
+
+bool cResultContainer::AddResultsFromXML(const std::string &strXmlFilePath, const tProgressCallback &progress)
 {
     struct stat fileStatus;
 
     if (stat(strXmlFilePath.c_str(), &fileStatus) == -1) // ==0 ok; ==-1 error
     {
-        // MAYBE do some error handling here...
-        // http://www.yolinux.com/TUTORIALS/XML-Xerces-C.html
-
-        std::cerr << "Could not read result file '" << strXmlFilePath << "'!" << std::endl << std::endl;
-        return;
+        LogError() << "Could not read result file '" << strXmlFilePath << "'!";
+        return false;
     }
-    else
-    {
-        xercesc::XercesDOMParser *pDomParser = new xercesc::XercesDOMParser();
 
-        pDomParser->setValidationScheme(XercesDOMParser::Val_Never);
-        pDomParser->setDoNamespaces(false);
-        pDomParser->setDoSchema(false);
-        pDomParser->setLoadExternalDTD(false);
+    xercesc::XercesDOMParser *pDomParser = new xercesc::XercesDOMParser();
+
+    pDomParser->setValidationScheme(XercesDOMParser::Val_Never);
+    pDomParser->setDoNamespaces(false);
+    pDomParser->setDoSchema(false);
+    pDomParser->setLoadExternalDTD(false);
 
-        try
+    // Bundles read before an error are removed again, so the container is unchanged if the file cannot be read
+    const std::size_t previousBundleCount = m_Bundles.size();
+    bool success = false;
+
+    try
+    {
+        bool cancelled = false;
+        if (progress)
         {
+            cProgressInputSource inputSource(strXmlFilePath, progress);
+            pDomParser->parse(inputSource);
+            cancelled = inputSource.IsCancelled();
+        }
+        else
             pDomParser->parse(strXmlFilePath.c_str());
 
-            DOMDocument *pXmlDoc = pDomParser->getDocument();
-            DOMElement *pRoot = pXmlDoc->getDocumentElement();
+        DOMDocument *pXmlDoc = pDomParser->getDocument();
+        DOMElement *pRoot = (nullptr != pXmlDoc) ? pXmlDoc->getDocumentElement() : nullptr;
 
+        // A cancelled file is reported as an unexpected end of the document, which is no error
+        if (!cancelled && (pDomParser->getErrorCount() > 0 || nullptr == pRoot))
+        {
+            LogError() << "Could not parse result file '" << strXmlFilePath << "'!";
+        }
+        else if (!cancelled)
+        {
             // Parse Root
-            if (nullptr != pRoot)
+            DOMNodeList *pChildList = pRoot->getChildNodes();
+            const XMLSize_t bundleSummaryNodeCount = pChildList->getLength();
+
+            for (XMLSize_t i = 0; i < bundleSummaryNodeCount; ++i)
             {
-                DOMNodeList *pChildList = pRoot->getChildNodes();
-                const XMLSize_t bundleSummaryNodeCount = pChildList->getLength();
+                DOMNode *pCurrentBundleSummaryNode = pChildList->item(i);
 
-                for (XMLSize_t i = 0; i < bundleSummaryNodeCount; ++i)
+                // Is element node...
+                if (pCurrentBundleSummaryNode->getNodeType() == DOMNode::ELEMENT_NODE)
                 {
-                    DOMNode *pCurrentBundleSummaryNode = pChildList->item(i);
+                    DOMElement *currentBundleSummaryElement =
+                        dynamic_cast<xercesc::DOMElement *>(pCurrentBundleSummaryNode);
+                    const char *currentTagName = XMLString::transcode(currentBundleSummaryElement->getTagName());
 
-                    // Is element node...
-                    if (pCurrentBundleSummaryNode->getNodeType() == DOMNode::ELEMENT_NODE)
+                    // Parse BundleSummary
+                    if (Equals(currentTagName, XMLString::transcode(cCheckerBundle::TAG_CHECKER_BUNDLE)))
                     {
-                        DOMElement *currentBundleSummaryElement =
-                            dynamic_cast<xercesc::DOMElement *>(pCurrentBundleSummaryNode);
-                        const char *currentTagName = XMLString::transcode(currentBundleSummaryElement->getTagName());
-
-                        // Parse BundleSummary
-                        if (Equals(currentTagName, XMLString::transcode(cCheckerBundle::TAG_CHECKER_BUNDLE)))
-                        {
-                            cCheckerBundle::ParseFromXML(pCurrentBundleSummaryNode, currentBundleSummaryElement, this);
-                        }
+                        cCheckerBundle::ParseFromXML(pCurrentBundleSummaryNode, currentBundleSummaryElement, this);
                     }
                 }
             }
+            success = true;
         }
-        catch (std::exception e)
+    }
+    catch (const std::exception &e)
+    {
+        LogError() << "Error parsing file: " << e.what();
+    }
+    catch (const XMLException &e)
+    {
+        char *message = XMLString::transcode(e.getMessage());
+        LogError() << "Error parsing file: " << message;
+        XMLString::release(&message);
+    }
+
+    if (!success)
+    {
+        while (m_Bundles.size() > previousBundleCount)
         {
-            std::cerr << "Error parsing file: " << e.what() << std::flush << std::endl;
+            m_Bundles.back()->Clear();
+            delete m_Bundles.back();
+            m_Bundles.pop_back();
         }
-
-        delete pDomParser;
+        InvalidateQueryIndex();
     }
+
+    delete pDomParser;
+    return success;
+}
+
+void cResultContainer::Swap(cResultContainer &other)
+{
+    m_Bundles.swap(other.m_Bundles);
+    std::swap(m_NextFreeId, other.m_NextFreeId);
+
+    for (cCheckerBundle *bundle : m_Bundles)
+        bundle->AssignResultContainer(this);
+
+    for (cCheckerBundle *bundle : other.m_Bundles)
+        bundle->AssignResultContainer(&other);
+
+    InvalidateQueryIndex();
+    other.InvalidateQueryIndex();
 }
 
 // Counts the Issues
@@ -184,6 +255,45 @@ unsigned int cResultContainer::GetIssueCount() const
     return result;
 }
 
+// Counts the Issues with a given level
+unsigned int cResultContainer::GetIssueCount(eIssueLevel level) const
+{
+    unsigned int result = 0;
+
+    for (std::list<cCheckerBundle *>::const_iterator it = m_Bundles.begin(); it != m_Bundles.end(); it++)
+    {
+        result += (*it)->GetIssueCount(level);
+    }
+
+    return result;
+}
+
+// Counts the enabled Issues
+unsigned int cResultContainer::GetEnabledIssuesCount() const
+{
+    unsigned int result = 0;
+
+    for (std::list<cCheckerBundle *>::const_iterator it = m_Bundles.begin(); it != m_Bundles.end(); it++)
+    {
+        result += (unsigned int)(*it)->GetEnabledIssuesCount();
+    }
+
+    return result;
+}
+
+// Counts the enabled Issues with a given level
+unsigned int cResultContainer::GetEnabledIssuesCount(eIssueLevel level) const
+{
+    unsigned int result = 0;
+
+    for (std::list<cCheckerBundle *>::const_iterator it = m_Bundles.begin(); it != m_Bundles.end(); it++)
+    {
+        result += (unsigned int)(*it)->GetEnabledIssuesCount(level);
+    }
+
+    return result;
+}
+
 // Counts the Checkers
 unsigned int cResultContainer::GetCheckerCount() const
 {
@@ -400,6 +510,30 @@ void cResultContainer::DoProcessing(void (*funcIteratorPtr)(cCheckerBundle *, cC
     }
 }
 
+void cResultContainer::DoProcessing(const std::function<void(cCheckerBundle *, cChecker *, cIssue *)> &func,
+                                    eExecutionPolicy policy)
+{
+    if (policy == eExecutionPolicy::SEQUENTIAL)
+    {
+        for (cCheckerBundle *bundle : m_Bundles)
+        {
+            for (cChecker *checker : bundle->m_Checkers)
+            {
+                for (cIssue *issue : checker->m_Issues)
+                    func(bundle, checker, issue);
+            }
+        }
+        return;
+    }
+
+    std::vector<cChecker *> checkers;
+    for (cCheckerBundle *bundle : m_Bundles)
+        checkers.insert(checkers.end(), bundle->m_Checkers.begin(), bundle->m_Checkers.end());
+
+    cChecker::ProcessIssuesConcurrently(
+        checkers, [&](cChecker *checker, cIssue *issue) { func(checker->m_Bundle, checker, issue); });
+}
+
 // Returns the next free ID
 unsigned long long cResultContainer::NextFreeId()
 {
@@ -467,3 +601,36 @@ cCheckerBundle *cResultContainer::GetCheckerBundleByName(const std::string &strB
 
     return nullptr;
 }
+
+std::vector<cIssueHandle> cResultContainer::Query(const cResultQuery &query) const
+{
+    std::lock_guard<std::mutex> lock(m_QueryIndex->m_Mutex);
+
+    if (nullptr == m_QueryIndex->m_Index)
+        m_QueryIndex->m_Index.reset(new cResultIndex(m_Bundles));
+
+    cResultIndex::tRows rows = m_QueryIndex->m_Index->Execute(query);
+
+    std::vector<cIssueHandle> result;
+    result.reserve(rows.size());
+    for (uint32_t row : rows)
+        result.push_back(m_QueryIndex->m_Index->GetHandle(row));
+
+    return result;
+}
+
+void cResultContainer::InvalidateQueryIndex()
+{
+    std::lock_guard<std::mutex> lock(m_QueryIndex->m_Mutex);
+    m_QueryIndex->m_Index.reset();
+}
+
+void cResultContainer::SetBaseline(cIssueBaseline *baseline)
+{
+    m_Baseline = baseline;
+}
+
+cIssueBaseline *cResultContainer::GetBaseline() const
+{
+    return m_Baseline;
+}
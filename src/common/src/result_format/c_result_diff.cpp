@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/result_format/c_result_diff.h"
+
+#include "common/result_format/c_issue_fingerprint.h"
+#include "common/result_format/c_result_container.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+// Marks the end of a chain of base issues with equal fingerprints
+static const uint32_t NO_ROW = UINT32_MAX;
+
+cResultDiff::cResultDiff()
+{
+}
+
+void cResultDiff::Compare(const cResultContainer &base, const cResultContainer &current, const cResultQuery &scope,
+                          eExecutionPolicy policy)
+{
+    Clear();
+
+    const std::vector<cIssueHandle> baseIssues = base.Query(scope);
+    const std::vector<cIssueHandle> currentIssues = current.Query(scope);
+
+    const std::vector<uint64_t> baseFingerprints = ComputeFingerprints(baseIssues, policy);
+    const std::vector<uint64_t> currentFingerprints = ComputeFingerprints(currentIssues, policy);
+
+    // Build side: every fingerprint points to its first unmatched base issue, further issues with the same
+    // fingerprint are chained in document order.
+    std::unordered_map<uint64_t, uint32_t> firstRow;
+    firstRow.reserve(baseIssues.size());
+    std::vector<uint32_t> nextRow(baseIssues.size(), NO_ROW);
+
+    for (std::size_t i = baseIssues.size(); i-- > 0;)
+    {
+        std::pair<std::unordered_map<uint64_t, uint32_t>::iterator, bool> inserted =
+            firstRow.emplace(baseFingerprints[i], (uint32_t)i);
+        if (!inserted.second)
+        {
+            nextRow[i] = inserted.first->second;
+            inserted.first->second = (uint32_t)i;
+        }
+    }
+
+    // Probe side: consume one base issue per matching current issue
+    std::vector<bool> matched(baseIssues.size(), false);
+    for (std::size_t i = 0; i < currentIssues.size(); i++)
+    {
+        std::unordered_map<uint64_t, uint32_t>::iterator it = firstRow.find(currentFingerprints[i]);
+        if (it != firstRow.end() && it->second != NO_ROW)
+        {
+            matched[it->second] = true;
+            it->second = nextRow[it->second];
+            m_Unchanged.push_back(currentIssues[i]);
+        }
+        else
+        {
+            m_Added.push_back(currentIssues[i]);
+        }
+    }
+
+    for (std::size_t i = 0; i < baseIssues.size(); i++)
+    {
+        if (!matched[i])
+            m_Removed.push_back(baseIssues[i]);
+    }
+}
+
+const std::vector<cIssueHandle> &cResultDiff::GetAdded() const
+{
+    return m_Added;
+}
+
+const std::vector<cIssueHandle> &cResultDiff::GetRemoved() const
+{
+    return m_Removed;
+}
+
+const std::vector<cIssueHandle> &cResultDiff::GetUnchanged() const
+{
+    return m_Unchanged;
+}
+
+void cResultDiff::Clear()
+{
+    m_Added.clear();
+    m_Removed.clear();
+    m_Unchanged.clear();
+}
+
+std::vector<uint64_t> cResultDiff::ComputeFingerprints(const std::vector<cIssueHandle> &handles,
+                                                       eExecutionPolicy policy)
+{
+    std::vector<uint64_t> fingerprints(handles.size());
+
+    // Hand out chunks instead of single issues to keep the scheduling overhead low
+    const std::size_t chunkCount = std::min<std::size_t>(handles.size(), 4 * (std::size_t)GetDefaultWorkerCount());
+    ForEachIndex(
+        chunkCount,
+        [&](std::size_t chunk) {
+            const std::size_t begin = handles.size() * chunk / chunkCount;
+            const std::size_t end = handles.size() * (chunk + 1) / chunkCount;
+            for (std::size_t i = begin; i < end; i++)
+                fingerprints[i] =
+                    cIssueFingerprint::Compute(handles[i].bundle, handles[i].checker, handles[i].issue);
+        },
+        policy);
+    return fingerprints;
+}
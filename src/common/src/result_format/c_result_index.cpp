@@ -0,0 +1,359 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/result_format/c_result_index.h"
+
+#include "common/result_format/c_checker.h"
+#include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_file_location.h"
+#include "common/result_format/c_inertial_location.h"
+#include "common/result_format/c_locations_container.h"
+#include "common/result_format/c_message_location.h"
+#include "common/result_format/c_time_location.h"
+#include "common/result_format/c_xml_location.h"
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+
+// Sorts rows and removes duplicates
+static void Normalize(cResultIndex::tRows &rows)
+{
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+}
+
+// Intersects two sorted row lists. Rows of a much smaller list are looked up in the larger one by binary search, so
+// the cost depends on the smaller list.
+static cResultIndex::tRows Intersect(const cResultIndex::tRows &smaller, const cResultIndex::tRows &larger)
+{
+    cResultIndex::tRows result;
+
+    if (smaller.size() * 16 < larger.size())
+    {
+        cResultIndex::tRows::const_iterator it = larger.begin();
+        for (uint32_t row : smaller)
+        {
+            it = std::lower_bound(it, larger.end(), row);
+            if (it == larger.end())
+                break;
+            if (*it == row)
+                result.push_back(row);
+        }
+    }
+    else
+    {
+        std::set_intersection(smaller.begin(), smaller.end(), larger.begin(), larger.end(),
+                              std::back_inserter(result));
+    }
+
+    return result;
+}
+
+// Returns true if value starts with prefix
+static bool StartsWith(const std::string &value, const std::string &prefix)
+{
+    return value.size() >= prefix.size() && value.compare(0, prefix.size(), prefix) == 0;
+}
+
+cResultIndex::cResultIndex(const std::list<cCheckerBundle *> &bundles)
+    : m_HasLevelIndex(false), m_HasRuleIndex(false), m_HasCheckerIndex(false), m_HasBundleIndex(false),
+      m_HasLocationIndex(false)
+{
+    for (cCheckerBundle *bundle : bundles)
+    {
+        for (cChecker *checker : bundle->GetCheckers())
+        {
+            for (cIssue *issue : checker->GetIssues())
+                m_Rows.push_back({bundle, checker, issue});
+        }
+    }
+}
+
+std::size_t cResultIndex::GetRowCount() const
+{
+    return m_Rows.size();
+}
+
+const cIssueHandle &cResultIndex::GetHandle(uint32_t row) const
+{
+    return m_Rows[row];
+}
+
+void cResultIndex::BuildLevelIndex()
+{
+    m_LevelRows.assign(INFO_LVL + 1, tRows());
+    for (uint32_t row = 0; row < m_Rows.size(); row++)
+    {
+        const int level = (int)m_Rows[row].issue->GetIssueLevel();
+        if (level >= ERROR_LVL && level <= INFO_LVL)
+            m_LevelRows[level].push_back(row);
+    }
+    m_HasLevelIndex = true;
+}
+
+void cResultIndex::BuildRuleIndex()
+{
+    for (uint32_t row = 0; row < m_Rows.size(); row++)
+        m_RuleRows[m_Rows[row].issue->GetRuleUID()].push_back(row);
+    m_HasRuleIndex = true;
+}
+
+void cResultIndex::BuildCheckerIndex()
+{
+    for (uint32_t row = 0; row < m_Rows.size(); row++)
+        m_CheckerRows[m_Rows[row].checker->GetCheckerID()].push_back(row);
+    m_HasCheckerIndex = true;
+}
+
+void cResultIndex::BuildBundleIndex()
+{
+    for (uint32_t row = 0; row < m_Rows.size(); row++)
+        m_BundleRows[m_Rows[row].bundle->GetBundleName()].push_back(row);
+    m_HasBundleIndex = true;
+}
+
+void cResultIndex::BuildLocationIndex()
+{
+    m_LocationTypes.assign(m_Rows.size(), 0);
+
+    for (uint32_t row = 0; row < m_Rows.size(); row++)
+    {
+        uint8_t types = 0;
+
+        for (cLocationsContainer *location : m_Rows[row].issue->GetLocationsContainer())
+        {
+            for (cExtendedInformation *info : location->GetExtendedInformations())
+            {
+                if (cXMLLocation *xmlLocation = dynamic_cast<cXMLLocation *>(info))
+                {
+                    types |= (uint8_t)eLocationType::XML_LOCATION;
+                    m_XPathRows.emplace_back(xmlLocation->GetXPath(), row);
+                }
+                else if (cInertialLocation *inertialLocation = dynamic_cast<cInertialLocation *>(info))
+                {
+                    types |= (uint8_t)eLocationType::INERTIAL_LOCATION;
+                    m_InertialRows.push_back(
+                        {{inertialLocation->GetX(), inertialLocation->GetY(), inertialLocation->GetZ()}, row});
+                }
+                else if (cTimeLocation *timeLocation = dynamic_cast<cTimeLocation *>(info))
+                {
+                    types |= (uint8_t)eLocationType::TIME_LOCATION;
+                    m_TimeRows.emplace_back(timeLocation->GetTime(), row);
+                }
+                else if (cMessageLocation *messageLocation = dynamic_cast<cMessageLocation *>(info))
+                {
+                    types |= (uint8_t)eLocationType::MESSAGE_LOCATION;
+                    if (messageLocation->GetTime().has_value())
+                        m_TimeRows.emplace_back(messageLocation->GetTime().value(), row);
+                }
+                else if (dynamic_cast<cFileLocation *>(info))
+                {
+                    types |= (uint8_t)eLocationType::FILE_LOCATION;
+                }
+            }
+        }
+
+        m_LocationTypes[row] = types;
+    }
+
+    std::sort(m_XPathRows.begin(), m_XPathRows.end());
+    std::sort(m_TimeRows.begin(), m_TimeRows.end());
+    std::sort(m_InertialRows.begin(), m_InertialRows.end());
+    m_HasLocationIndex = true;
+}
+
+cResultIndex::tRows cResultIndex::FindRuleRows(const std::string &prefix) const
+{
+    tRows result;
+    for (std::map<std::string, tRows>::const_iterator it = m_RuleRows.lower_bound(prefix);
+         it != m_RuleRows.end() && StartsWith(it->first, prefix); it++)
+    {
+        result.insert(result.end(), it->second.begin(), it->second.end());
+    }
+    Normalize(result);
+    return result;
+}
+
+cResultIndex::tRows cResultIndex::FindXPathRows(const std::string &prefix) const
+{
+    tRows result;
+    std::vector<std::pair<std::string, uint32_t>>::const_iterator it =
+        std::lower_bound(m_XPathRows.begin(), m_XPathRows.end(), std::make_pair(prefix, (uint32_t)0));
+
+    for (; it != m_XPathRows.end() && StartsWith(it->first, prefix); it++)
+        result.push_back(it->second);
+
+    Normalize(result);
+    return result;
+}
+
+cResultIndex::tRows cResultIndex::FindTimeRows(double minTime, double maxTime) const
+{
+    tRows result;
+    std::vector<std::pair<double, uint32_t>>::const_iterator it =
+        std::lower_bound(m_TimeRows.begin(), m_TimeRows.end(), std::make_pair(minTime, (uint32_t)0));
+
+    for (; it != m_TimeRows.end() && it->first <= maxTime; it++)
+        result.push_back(it->second);
+
+    Normalize(result);
+    return result;
+}
+
+cResultIndex::tRows cResultIndex::FindInertialRows(const cResultQuery &query) const
+{
+    tRows result;
+    std::array<double, 3> lowerCorner = {query.GetInertialMin(0), query.GetInertialMin(1), query.GetInertialMin(2)};
+
+    // The entries are sorted by x, so only the x range has to be scanned
+    std::vector<std::pair<std::array<double, 3>, uint32_t>>::const_iterator it =
+        std::lower_bound(m_InertialRows.begin(), m_InertialRows.end(), std::make_pair(lowerCorner, (uint32_t)0),
+                         [](const std::pair<std::array<double, 3>, uint32_t> &a,
+                            const std::pair<std::array<double, 3>, uint32_t> &b) { return a.first[0] < b.first[0]; });
+
+    for (; it != m_InertialRows.end() && it->first[0] <= query.GetInertialMax(0); it++)
+    {
+        if (it->first[1] >= query.GetInertialMin(1) && it->first[1] <= query.GetInertialMax(1) &&
+            it->first[2] >= query.GetInertialMin(2) && it->first[2] <= query.GetInertialMax(2))
+        {
+            result.push_back(it->second);
+        }
+    }
+
+    Normalize(result);
+    return result;
+}
+
+cResultIndex::tRows cResultIndex::Execute(const cResultQuery &query)
+{
+    static const tRows EMPTY_ROWS;
+
+    // Candidate rows of every indexed predicate. Posting lists of the indexes are referenced, only rows which are
+    // combined from several lists are computed and kept in computedRows.
+    std::vector<const tRows *> candidates;
+    std::deque<tRows> computedRows;
+
+    if (!query.GetLevels().empty())
+    {
+        if (!m_HasLevelIndex)
+            BuildLevelIndex();
+
+        std::vector<const tRows *> levelRows;
+        for (eIssueLevel level : query.GetLevels())
+        {
+            if (level >= ERROR_LVL && level <= INFO_LVL)
+                levelRows.push_back(&m_LevelRows[level]);
+        }
+
+        if (levelRows.size() == 1)
+            candidates.push_back(levelRows[0]);
+        else
+        {
+            computedRows.emplace_back();
+            for (const tRows *rows : levelRows)
+                computedRows.back().insert(computedRows.back().end(), rows->begin(), rows->end());
+            Normalize(computedRows.back());
+            candidates.push_back(&computedRows.back());
+        }
+    }
+
+    if (query.GetRuleUID().has_value())
+    {
+        if (!m_HasRuleIndex)
+            BuildRuleIndex();
+
+        if (query.IsRuleUIDPrefix())
+        {
+            computedRows.push_back(FindRuleRows(query.GetRuleUID().value()));
+            candidates.push_back(&computedRows.back());
+        }
+        else
+        {
+            std::map<std::string, tRows>::const_iterator it = m_RuleRows.find(query.GetRuleUID().value());
+            candidates.push_back((it != m_RuleRows.end()) ? &it->second : &EMPTY_ROWS);
+        }
+    }
+
+    if (query.GetCheckerID().has_value())
+    {
+        if (!m_HasCheckerIndex)
+            BuildCheckerIndex();
+        std::unordered_map<std::string, tRows>::const_iterator it = m_CheckerRows.find(query.GetCheckerID().value());
+        candidates.push_back((it != m_CheckerRows.end()) ? &it->second : &EMPTY_ROWS);
+    }
+
+    if (query.GetBundleName().has_value())
+    {
+        if (!m_HasBundleIndex)
+            BuildBundleIndex();
+        std::unordered_map<std::string, tRows>::const_iterator it = m_BundleRows.find(query.GetBundleName().value());
+        candidates.push_back((it != m_BundleRows.end()) ? &it->second : &EMPTY_ROWS);
+    }
+
+    const bool needsLocations = query.GetLocationTypes() != 0 || query.GetXPathPrefix().has_value() ||
+                                query.HasTimeRange() || query.HasInertialRange();
+    if (needsLocations && !m_HasLocationIndex)
+        BuildLocationIndex();
+
+    if (query.GetXPathPrefix().has_value())
+    {
+        computedRows.push_back(FindXPathRows(query.GetXPathPrefix().value()));
+        candidates.push_back(&computedRows.back());
+    }
+
+    if (query.HasTimeRange())
+    {
+        computedRows.push_back(FindTimeRows(query.GetMinTime(), query.GetMaxTime()));
+        candidates.push_back(&computedRows.back());
+    }
+
+    if (query.HasInertialRange())
+    {
+        computedRows.push_back(FindInertialRows(query));
+        candidates.push_back(&computedRows.back());
+    }
+
+    // Intersect, beginning with the smallest candidate set
+    tRows result;
+    if (candidates.empty())
+    {
+        result.resize(m_Rows.size());
+        for (uint32_t row = 0; row < m_Rows.size(); row++)
+            result[row] = row;
+    }
+    else
+    {
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const tRows *a, const tRows *b) { return a->size() < b->size(); });
+
+        if (candidates.size() == 1)
+            result = *candidates[0];
+        else
+            result = Intersect(*candidates[0], *candidates[1]);
+
+        for (std::size_t i = 2; i < candidates.size() && !result.empty(); i++)
+            result = Intersect(result, *candidates[i]);
+    }
+
+    // Apply the predicates without index
+    const unsigned int locationTypes = query.GetLocationTypes();
+    if (locationTypes != 0 || query.IsEnabledOnly())
+    {
+        result.erase(std::remove_if(result.begin(), result.end(),
+                                    [this, locationTypes, &query](uint32_t row) {
+                                        const unsigned int rowTypes = m_HasLocationIndex ? m_LocationTypes[row] : 0;
+                                        if ((rowTypes & locationTypes) != locationTypes)
+                                            return true;
+                                        return query.IsEnabledOnly() && !m_Rows[row].issue->IsEnabled();
+                                    }),
+                     result.end());
+    }
+
+    return result;
+}
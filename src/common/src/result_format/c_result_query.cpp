@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/result_format/c_result_query.h"
+
+#include <algorithm>
+
+cResultQuery::cResultQuery()
+    : m_RuleUIDIsPrefix(false), m_LocationTypes(0), m_HasTimeRange(false), m_MinTime(0.0), m_MaxTime(0.0),
+      m_HasInertialRange(false), m_InertialMin{0.0, 0.0, 0.0}, m_InertialMax{0.0, 0.0, 0.0}, m_EnabledOnly(false)
+{
+}
+
+cResultQuery &cResultQuery::AddLevel(eIssueLevel level)
+{
+    if (std::find(m_Levels.begin(), m_Levels.end(), level) == m_Levels.end())
+        m_Levels.push_back(level);
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetRuleUID(const std::string &ruleUID)
+{
+    m_RuleUID = ruleUID;
+    m_RuleUIDIsPrefix = false;
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetRuleUIDPrefix(const std::string &ruleUIDPrefix)
+{
+    m_RuleUID = ruleUIDPrefix;
+    m_RuleUIDIsPrefix = true;
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetCheckerID(const std::string &checkerID)
+{
+    m_CheckerID = checkerID;
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetBundleName(const std::string &bundleName)
+{
+    m_BundleName = bundleName;
+    return *this;
+}
+
+cResultQuery &cResultQuery::AddLocationType(eLocationType locationType)
+{
+    m_LocationTypes |= (unsigned int)locationType;
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetXPathPrefix(const std::string &xpathPrefix)
+{
+    m_XPathPrefix = xpathPrefix;
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetTimeRange(double minTime, double maxTime)
+{
+    m_HasTimeRange = true;
+    m_MinTime = minTime;
+    m_MaxTime = maxTime;
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetInertialRange(double minX, double minY, double minZ, double maxX, double maxY,
+                                             double maxZ)
+{
+    m_HasInertialRange = true;
+    m_InertialMin[0] = minX;
+    m_InertialMin[1] = minY;
+    m_InertialMin[2] = minZ;
+    m_InertialMax[0] = maxX;
+    m_InertialMax[1] = maxY;
+    m_InertialMax[2] = maxZ;
+    return *this;
+}
+
+cResultQuery &cResultQuery::SetEnabledOnly(bool enabledOnly)
+{
+    m_EnabledOnly = enabledOnly;
+    return *this;
+}
+
+const std::vector<eIssueLevel> &cResultQuery::GetLevels() const
+{
+    return m_Levels;
+}
+
+const std::optional<std::string> &cResultQuery::GetRuleUID() const
+{
+    return m_RuleUID;
+}
+
+bool cResultQuery::IsRuleUIDPrefix() const
+{
+    return m_RuleUIDIsPrefix;
+}
+
+const std::optional<std::string> &cResultQuery::GetCheckerID() const
+{
+    return m_CheckerID;
+}
+
+const std::optional<std::string> &cResultQuery::GetBundleName() const
+{
+    return m_BundleName;
+}
+
+unsigned int cResultQuery::GetLocationTypes() const
+{
+    return m_LocationTypes;
+}
+
+const std::optional<std::string> &cResultQuery::GetXPathPrefix() const
+{
+    return m_XPathPrefix;
+}
+
+bool cResultQuery::HasTimeRange() const
+{
+    return m_HasTimeRange;
+}
+
+double cResultQuery::GetMinTime() const
+{
+    return m_MinTime;
+}
+
+double cResultQuery::GetMaxTime() const
+{
+    return m_MaxTime;
+}
+
+bool cResultQuery::HasInertialRange() const
+{
+    return m_HasInertialRange;
+}
+
+double cResultQuery::GetInertialMin(int axis) const
+{
+    return m_InertialMin[axis];
+}
+
+double cResultQuery::GetInertialMax(int axis) const
+{
+    return m_InertialMax[axis];
+}
+
+bool cResultQuery::IsEnabledOnly() const
+{
+    return m_EnabledOnly;
+}
@@ -14,6 +14,7 @@
 #include <QtCore/QString>
 #include <QtXml/QDomDocument>
 
+#include "common/c_logger.h"
 #include "common/result_format/c_file_location.h"
 
 #include <iostream>
@@ -187,8 +188,7 @@ bool CheckIfFileExists(std::string filePath, const bool printLog)
     if (stat(filePath.c_str(), &fileStatus) == -1) // ==0 ok; ==-1 error
     {
         if (printLog)
-            std::cout << "File " << filePath << " could not be parsed. Please check file path and if file exists"
-                      << std::endl;
+            LogError() << "File " << filePath << " could not be parsed. Please check file path and if file exists";
 
         return false;
     }
@@ -224,7 +224,7 @@ bool GetXodrFilePathFromXosc(const std::string xoscFilePath, std::string &strPat
 
     if (xoscFilePath.empty())
     {
-        std::cerr << basicErrorMsg << "Invalid XOSC file path." << std::endl;
+        LogError() << basicErrorMsg << "Invalid XOSC file path.";
         return false;
     }
 
@@ -233,7 +233,7 @@ bool GetXodrFilePathFromXosc(const std::string xoscFilePath, std::string &strPat
     if (!f.open(QIODevice::ReadOnly))
     {
         // Error while loading file
-        std::cerr << basicErrorMsg << "Error while loading file" << std::endl;
+        LogError() << basicErrorMsg << "Error while loading file";
         return false;
     }
     // Set data into the QDomDocument before processing
@@ -273,7 +273,7 @@ bool GetXodrFilePathFromXosc(const std::string xoscFilePath, std::string &strPat
 
     if (xodrFilePath.isEmpty())
     {
-        std::cerr << basicErrorMsg << "xodr file is not specified in xosc file." << std::endl;
+        LogError() << basicErrorMsg << "xodr file is not specified in xosc file.";
         return false;
     }
 
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/util_parallel.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+unsigned int GetDefaultWorkerCount()
+{
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return (hardwareThreads > 0) ? hardwareThreads : 1;
+}
+
+void ForEachIndex(std::size_t count, const std::function<void(std::size_t)> &func, eExecutionPolicy policy,
+                  unsigned int workerCount)
+{
+    if (workerCount == 0)
+        workerCount = GetDefaultWorkerCount();
+
+    if (policy == eExecutionPolicy::SEQUENTIAL || workerCount < 2 || count < 2)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            func(i);
+        return;
+    }
+
+    if (workerCount > count)
+        workerCount = (unsigned int)count;
+
+    std::atomic<std::size_t> nextIndex(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto worker = [&]() {
+        while (!failed)
+        {
+            const std::size_t index = nextIndex++;
+            if (index >= count)
+                break;
+
+            try
+            {
+                func(index);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!firstException)
+                    firstException = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    // The calling thread is one of the workers
+    std::vector<std::thread> threads;
+    threads.reserve(workerCount - 1);
+    for (unsigned int i = 1; i < workerCount; i++)
+        threads.emplace_back(worker);
+
+    worker();
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    if (firstException)
+        std::rethrow_exception(firstException);
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "common/xml/c_progress_input_source.h"
+
+#include <xercesc/util/BinFileInputStream.hpp>
+
+XERCES_CPP_NAMESPACE_USE
+
+/*
+ * Stream which forwards to a file stream and calls the progress callback after every block
+ */
+class cProgressBinInputStream : public BinInputStream
+{
+  public:
+    cProgressBinInputStream(BinFileInputStream *fileStream, const tProgressCallback &progress,
+                            std::atomic<bool> &cancelled)
+        : m_FileStream(fileStream), m_Progress(progress), m_Cancelled(cancelled),
+          m_Size((uint64_t)fileStream->getSize())
+    {
+    }
+
+    ~cProgressBinInputStream() override
+    {
+        delete m_FileStream;
+    }
+
+    XMLFilePos curPos() const override
+    {
+        return m_FileStream->curPos();
+    }
+
+    XMLSize_t readBytes(XMLByte *const toFill, const XMLSize_t maxToRead) override
+    {
+        if (m_Cancelled)
+            return 0;
+
+        const XMLSize_t bytesRead = m_FileStream->readBytes(toFill, maxToRead);
+
+        if (m_Progress && !m_Progress((uint64_t)m_FileStream->curPos(), m_Size))
+        {
+            m_Cancelled = true;
+            return 0;
+        }
+
+        return bytesRead;
+    }
+
+    const XMLCh *getContentType() const override
+    {
+        return m_FileStream->getContentType();
+    }
+
+  private:
+    BinFileInputStream *m_FileStream;
+    const tProgressCallback &m_Progress;
+    std::atomic<bool> &m_Cancelled;
+    uint64_t m_Size;
+};
+
+cProgressInputSource::cProgressInputSource(const std::string &strFilePath, tProgressCallback progress)
+    : InputSource(strFilePath.c_str()), m_FilePath(strFilePath), m_Progress(std::move(progress)), m_Cancelled(false)
+{
+}
+
+BinInputStream *cProgressInputSource::makeStream() const
+{
+    BinFileInputStream *fileStream = new BinFileInputStream(m_FilePath.c_str());
+    if (!fileStream->getIsOpen())
+    {
+        delete fileStream;
+        return nullptr;
+    }
+
+    return new cProgressBinInputStream(fileStream, m_Progress, m_Cancelled);
+}
+
+bool cProgressInputSource::IsCancelled() const
+{
+    return m_Cancelled;
+}
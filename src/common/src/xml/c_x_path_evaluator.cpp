@@ -10,6 +10,7 @@
 
 #include "common/xml/c_x_path_evaluator.h"
 
+#include "common/c_logger.h"
 #include "common/result_format/c_file_location.h"
 
 cXPathEvaluator::cXPathEvaluator()
@@ -28,7 +29,7 @@ bool cXPathEvaluator::SetXmlContent(const QString xmlFilePath)
     bool success = ReadDOMFromFile(xmlFilePath, domDocument);
     if (!success)
     {
-        std::cerr << errorMsg << std::endl << std::endl;
+        LogError() << errorMsg << "\n";
         return success;
     }
 
@@ -39,7 +40,7 @@ bool cXPathEvaluator::SetXmlContent(const QString xmlFilePath)
     success = query.setFocus(extendedXmlContent);
     if (!success)
     {
-        std::cerr << errorMsg << std::endl << std::endl;
+        LogError() << errorMsg << "\n";
     }
 
     return success;
@@ -67,7 +68,7 @@ bool cXPathEvaluator::ReadDOMFromFile(const QString xmlFilePath, QDomDocument &d
 
     if (!xmlFile.exists())
     {
-        std::cerr << "File '" << xmlFilePath.toLocal8Bit().data() << "' does not exist." << std::endl;
+        LogError() << "File '" << xmlFilePath.toLocal8Bit().data() << "' does not exist.";
         return false;
     }
 
@@ -76,14 +77,13 @@ bool cXPathEvaluator::ReadDOMFromFile(const QString xmlFilePath, QDomDocument &d
 
     if (!xmlFile.open(QIODevice::ReadOnly | QIODevice::Text))
     {
-        std::cerr << "Could not open file '" << xmlFilePath.toLocal8Bit().data() << "'." << std::endl;
+        LogError() << "Could not open file '" << xmlFilePath.toLocal8Bit().data() << "'.";
         return false;
     }
 
     if (!domDocument.setContent(&xmlFile))
     {
-        std::cerr << "Could not set content of file '" << xmlFilePath.toLocal8Bit().data() << "' to DOM document."
-                  << std::endl;
+        LogError() << "Could not set content of file '" << xmlFilePath.toLocal8Bit().data() << "' to DOM document.";
         xmlFile.close();
         return false;
     }
@@ -111,7 +111,7 @@ bool cXPathEvaluator::GetXmlResultOfXPath(const QString xpath, QString &xmlResul
     query.setQuery(xpath);
     if (!query.isValid())
     {
-        std::cerr << "Query for xpath '" << xpath.toLocal8Bit().data() << "' is not valid." << std::endl;
+        LogWarning("Invalid xpath") << "Query for xpath '" << xpath.toLocal8Bit().data() << "' is not valid.";
         return false;
     }
 
@@ -121,7 +121,7 @@ bool cXPathEvaluator::GetXmlResultOfXPath(const QString xpath, QString &xmlResul
 
     if (xmlResult.isNull() || xmlResult.isEmpty() || xmlResult.size() < 2)
     {
-        std::cerr << "Query for xpath '" << xpath.toLocal8Bit().data() << "' found no result." << std::endl;
+        LogWarning("Xpath without result") << "Query for xpath '" << xpath.toLocal8Bit().data() << "' found no result.";
         return false;
     }
     return true;
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_github_ci_stream_handler.h"
+
+#include "common/c_logger.h"
+#include "common/result_format/c_checker.h"
+#include "common/result_format/c_issue.h"
+
+#include <cstdlib>
+
+#include <xercesc/sax/SAXParseException.hpp>
+#include <xercesc/util/XMLString.hpp>
+
+XERCES_CPP_NAMESPACE_USE
+
+// Transcodes an attribute value. Missing attributes result in an empty string.
+static std::string GetAttribute(const Attributes &attrs, const XMLCh *name)
+{
+    const XMLCh *value = attrs.getValue(name);
+    if (value == nullptr)
+        return "";
+
+    char *transcoded = XMLString::transcode(value);
+    std::string result(transcoded);
+    XMLString::release(&transcoded);
+    return result;
+}
+
+cGithubCIStreamHandler::cGithubCIStreamHandler(std::ostream &stream, unsigned int maxAnnotations,
+                                               unsigned int stopAfterErrors)
+    : m_Stream(stream), m_MaxAnnotations(maxAnnotations), m_StopAfterErrors(stopAfterErrors), m_IssueCount(0),
+      m_AnnotationCount(0), m_SkippedCount(0), m_ErrorCount(0), m_HasParseError(false)
+{
+}
+
+void cGithubCIStreamHandler::startElement(const XMLCh *const, const XMLCh *const localname, const XMLCh *const,
+                                          const Attributes &attrs)
+{
+    if (XMLString::equals(localname, cChecker::TAG_CHECKER))
+    {
+        m_CheckerID = GetAttribute(attrs, cChecker::ATTR_CHECKER_ID);
+        return;
+    }
+
+    if (!XMLString::equals(localname, cIssue::TAG_ISSUE) || IsFinished())
+        return;
+
+    // Issues get the id the result container would assign, not the one stored in the file
+    const unsigned long long issueId = m_IssueCount++;
+
+    const char *levelPrefix = nullptr;
+    const eIssueLevel level = (eIssueLevel)atoi(GetAttribute(attrs, cIssue::ATTR_LEVEL).c_str());
+    switch (level)
+    {
+    case eIssueLevel::ERROR_LVL:
+        levelPrefix = "::error::";
+        m_ErrorCount++;
+        break;
+    case eIssueLevel::WARNING_LVL:
+        levelPrefix = "::warning::";
+        break;
+    case eIssueLevel::INFO_LVL:
+        levelPrefix = "::notice::";
+        break;
+    default:
+        return;
+    }
+
+    if (m_MaxAnnotations != 0 && m_AnnotationCount >= m_MaxAnnotations)
+    {
+        m_SkippedCount++;
+        return;
+    }
+
+    // Same format as the report of the whole result container, which prefixes descriptions with the issue id
+    m_Stream << levelPrefix << m_CheckerID << ": #" << issueId << ": " << GetAttribute(attrs, cIssue::ATTR_DESCRIPTION)
+             << "\n";
+    m_AnnotationCount++;
+}
+
+void cGithubCIStreamHandler::fatalError(const SAXParseException &exception)
+{
+    char *message = XMLString::transcode(exception.getMessage());
+    LogError() << "Error while reading result file at line " << exception.getLineNumber() << ": " << message;
+    XMLString::release(&message);
+
+    m_HasParseError = true;
+}
+
+bool cGithubCIStreamHandler::IsFinished() const
+{
+    if (m_HasParseError || m_ErrorCount == 0)
+        return m_HasParseError;
+
+    if (m_StopAfterErrors != 0 && m_ErrorCount >= m_StopAfterErrors)
+        return true;
+
+    // Nothing is written anymore and the verdict is known
+    return m_MaxAnnotations != 0 && m_AnnotationCount >= m_MaxAnnotations;
+}
+
+bool cGithubCIStreamHandler::HasError() const
+{
+    return m_ErrorCount > 0;
+}
+
+bool cGithubCIStreamHandler::HasParseError() const
+{
+    return m_HasParseError;
+}
+
+unsigned int cGithubCIStreamHandler::GetAnnotationCount() const
+{
+    return m_AnnotationCount;
+}
+
+unsigned int cGithubCIStreamHandler::GetSkippedCount() const
+{
+    return m_SkippedCount;
+}
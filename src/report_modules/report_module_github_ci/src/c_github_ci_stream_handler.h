@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cGithubCIStreamHandler_h__
+#define cGithubCIStreamHandler_h__
+
+#include <ostream>
+#include <string>
+
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+/*
+ * SAX handler which writes a GitHub CI annotation for every issue while a result file is read, so no result
+ * container has to be built.
+ *
+ * At most maxAnnotations annotations are written. Afterwards the handler only looks for errors, because they
+ * decide the exit code. The handler is finished as soon as the verdict is known: after stopAfterErrors errors, or
+ * after the first error once the annotation limit is reached. A value of 0 disables the respective limit.
+ */
+class cGithubCIStreamHandler : public XERCES_CPP_NAMESPACE::DefaultHandler
+{
+  public:
+    /*
+     * Creates a new handler
+     * \param stream: The stream which receives the annotations
+     * \param maxAnnotations: Maximum count of written annotations, 0 for no limit
+     * \param stopAfterErrors: Count of errors after which reading stops, 0 to read the whole file
+     */
+    cGithubCIStreamHandler(std::ostream &stream, unsigned int maxAnnotations, unsigned int stopAfterErrors);
+
+    virtual void startElement(const XMLCh *const uri, const XMLCh *const localname, const XMLCh *const qname,
+                              const XERCES_CPP_NAMESPACE::Attributes &attrs) override;
+
+    virtual void fatalError(const XERCES_CPP_NAMESPACE::SAXParseException &exception) override;
+
+    // Returns true if the rest of the file does not need to be read
+    bool IsFinished() const;
+
+    // Returns true if an issue with error level was read
+    bool HasError() const;
+
+    // Returns true if the file could not be parsed
+    bool HasParseError() const;
+
+    // Returns the count of written annotations
+    unsigned int GetAnnotationCount() const;
+
+    // Returns the count of issues which were read, but not written because of the annotation limit
+    unsigned int GetSkippedCount() const;
+
+  private:
+    std::ostream &m_Stream;
+    unsigned int m_MaxAnnotations;
+    unsigned int m_StopAfterErrors;
+
+    // Id of the checker whose issues are currently read
+    std::string m_CheckerID;
+
+    // Count of issues read so far, used as id of the next issue
+    unsigned long long m_IssueCount;
+
+    unsigned int m_AnnotationCount;
+    unsigned int m_SkippedCount;
+    unsigned int m_ErrorCount;
+    bool m_HasParseError;
+};
+
+#endif
@@ -9,6 +9,7 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 #include "report_format_github_ci.h"
+#include "common/c_logger.h"
 #include "common/config_format/c_configuration.h"
 #include "common/config_format/c_configuration_report_module.h"
 #include "common/result_format/c_checker.h"
@@ -20,11 +21,17 @@
 #include "common/result_format/c_parameter_container.h"
 #include "common/result_format/c_result_container.h"
 #include "common/result_format/c_xml_location.h"
+#include "c_github_ci_stream_handler.h"
 #include "stdafx.h"
 
 #include "common/qc4openx_filesystem.h"
+#include <algorithm>
 #include <set>
 
+#include <xercesc/framework/XMLPScanToken.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+
 XERCES_CPP_NAMESPACE_USE
 
 static const std::map<eIssueLevel, std::string> mapIssueLevelToString = {{eIssueLevel::INFO_LVL, "::notice::"},
@@ -60,8 +67,7 @@ int main(int argc, char *argv[])
     {
         if (!fs::exists(strFilepath.c_str()))
         {
-            std::cerr << "Could not open file '" << strFilepath << "'!" << std::endl
-                      << "Abort generating report!" << std::endl;
+            LogError() << "Could not open file '" << strFilepath << "'!\nAbort generating report!";
             return 1;
         }
 
@@ -71,10 +77,10 @@ int main(int argc, char *argv[])
     {
         cConfiguration configuration;
 
-        std::cout << "Config: " << strFilepath << std::endl;
+        LogInfo() << "Config: " << strFilepath;
         if (!cConfiguration::ParseFromXML(&configuration, strFilepath))
         {
-            std::cerr << "Could not read configuration! Abort." << std::endl;
+            LogError() << "Could not read configuration! Abort.";
             return -1;
         }
 
@@ -84,8 +90,8 @@ int main(int argc, char *argv[])
         if (nullptr != reportModuleConfig)
             inputParams.Overwrite(reportModuleConfig->GetParams());
         else
-            std::cerr << "No configuration for module '" << REPORT_MODULE_NAME << "' found. Start with default params."
-                      << std::endl;
+            LogWarning() << "No configuration for module '" << REPORT_MODULE_NAME
+                         << "' found. Start with default params.";
     }
     else if (StringEndsWith(ToLower(strFilepath), "--defaultconfig"))
     {
@@ -105,7 +111,10 @@ int main(int argc, char *argv[])
     }
 
     // Exit with code 1 if an error was found to fail the GitHub pipeline
-    if (RunGithubCIReport(inputParams))
+    const bool error_found = RunGithubCIReport(inputParams);
+    cLogger::GetInstance().WriteSummary();
+
+    if (error_found)
     {
         exit(1);
     }
@@ -130,22 +139,33 @@ bool RunGithubCIReport(const cParameterContainer &inputParams)
 {
     XMLPlatformUtils::Initialize();
 
+    if (ToLower(inputParams.GetParam("strReadMode", "full")) == "stream")
+    {
+        const bool error_found = StreamResults(
+            inputParams.GetParam("strInputFile"),
+            (unsigned int)std::max(0, atoi(inputParams.GetParam("iMaxAnnotations", "0").c_str())),
+            (unsigned int)std::max(0, atoi(inputParams.GetParam("iStopAfterErrors", "0").c_str())));
+
+        XMLPlatformUtils::Terminate();
+        return error_found;
+    }
+
     auto pResultContainer = std::make_unique<cResultContainer>();
 
-    bool error_found;
+    bool error_found = false;
 
     try
     {
-        std::cout << "Read result file: '" << inputParams.GetParam("strInputFile") << "' ..." << std::endl << std::endl;
+        LogInfo() << "Read result file: '" << inputParams.GetParam("strInputFile") << "' ...\n";
 
         pResultContainer->AddResultsFromXML(inputParams.GetParam("strInputFile"));
 
         // Add prefix with issue id
-        const std::list<cCheckerBundle *> checkerBundles = pResultContainer->GetCheckerBundles();
-        for (auto checkerBundle : checkerBundles)
-        {
-            checkerBundle->DoProcessing(AddPrefixForDescriptionIssueProcessor);
-        }
+        pResultContainer->DoProcessing(
+            [](cCheckerBundle *, cChecker *checker, cIssue *issue) {
+                AddPrefixForDescriptionIssueProcessor(checker, issue);
+            },
+            eExecutionPolicy::PARALLEL);
 
         error_found = PrintResults(pResultContainer);
     }
@@ -166,6 +186,9 @@ bool PrintResults(std::unique_ptr<cResultContainer> &pResultContainer)
 
     bool error_found = false;
 
+    // Annotations are written to stdout directly, behind the pending log output
+    cLogger::GetInstance().Flush();
+
     std::list<cCheckerBundle *> bundles = pResultContainer->GetCheckerBundles();
     // Loop over all checker bundles
     for (auto &bundle : bundles)
@@ -185,7 +208,7 @@ bool PrintResults(std::unique_ptr<cResultContainer> &pResultContainer)
                     if (issue_level != mapIssueLevelToString.end())
                     {
                         std::cout << issue_level->second << checker->GetCheckerID() << ": " << issue->GetDescription()
-                                  << std::endl;
+                                  << "\n";
                         if (issue->GetIssueLevel() == eIssueLevel::ERROR_LVL)
                         {
                             error_found = true;
@@ -195,9 +218,43 @@ bool PrintResults(std::unique_ptr<cResultContainer> &pResultContainer)
             }
         }
     }
+    std::cout.flush();
     return error_found;
 }
 
+// Prints results in GitHub CI format while the result file is read
+bool StreamResults(const std::string &strResultFile, unsigned int maxAnnotations, unsigned int stopAfterErrors)
+{
+    // Annotations are written to stdout directly, behind the pending log output
+    cLogger::GetInstance().Flush();
+    cGithubCIStreamHandler handler(std::cout, maxAnnotations, stopAfterErrors);
+
+    std::unique_ptr<SAX2XMLReader> parser(XMLReaderFactory::createXMLReader());
+    parser->setContentHandler(&handler);
+    parser->setErrorHandler(&handler);
+
+    // The file is read progressively, so reading can stop as soon as the verdict is known
+    XMLPScanToken token;
+    if (!parser->parseFirst(strResultFile.c_str(), token))
+    {
+        LogError() << "Could not read result file '" << strResultFile << "'!";
+        return true;
+    }
+
+    while (!handler.IsFinished() && parser->parseNext(token))
+    {
+    }
+    parser->parseReset(token);
+
+    if (handler.GetSkippedCount() > 0)
+        std::cout << "::notice::Only the first " << handler.GetAnnotationCount() << " issues are annotated" << "\n";
+
+    std::cout.flush();
+
+    // A result file which cannot be read fails the pipeline as well
+    return handler.HasError() || handler.HasParseError();
+}
+
 void AddPrefixForDescriptionIssueProcessor(cChecker *, cIssue *issueToProcess)
 {
     std::stringstream ssDescription;
@@ -212,13 +269,15 @@ void WriteDefaultConfig()
 
     cConfigurationReportModule *reportModuleConfig = defaultConfig.AddReportModule(REPORT_MODULE_NAME);
     reportModuleConfig->SetParam("strInputFile", "Result.xqar");
+    reportModuleConfig->SetParam("strReadMode", "full");
+    reportModuleConfig->SetParam("iMaxAnnotations", "0");
+    reportModuleConfig->SetParam("iStopAfterErrors", "0");
 
     std::stringstream ssConfigFile;
     ssConfigFile << REPORT_MODULE_NAME << ".xml";
 
-    std::cout << std::endl;
-    std::cout << "Write default config: '" << ssConfigFile.str() << "'" << std::endl << std::endl;
+    LogInfo() << "\nWrite default config: '" << ssConfigFile.str() << "'\n";
     defaultConfig.WriteConfigurationToFile(ssConfigFile.str());
 
-    std::cout << "Finished." << std::endl;
+    LogInfo() << "Finished.";
 }
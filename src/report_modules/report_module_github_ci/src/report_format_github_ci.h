@@ -62,6 +62,19 @@ void WriteDefaultConfig();
  */
 bool PrintResults(std::unique_ptr<cResultContainer> &pResultContainer);
 
+/**
+ * Prints the issues of a result file in the GitHub CI format while the file is read.
+ *
+ * No result container is built. Reading stops as soon as the exit code is known, see cGithubCIStreamHandler.
+ *
+ * @param strResultFile   Path of the result file
+ * @param maxAnnotations  Maximum count of printed issues, 0 for no limit
+ * @param stopAfterErrors Count of errors after which reading stops, 0 to read the whole file
+ *
+ * @return True if an error was found in the results or the file could not be read
+ */
+bool StreamResults(const std::string &strResultFile, unsigned int maxAnnotations, unsigned int stopAfterErrors);
+
 /**
  * Adds a prefix to the description of an issue.
  * This function takes an issue and prepends the issue ID to the description,
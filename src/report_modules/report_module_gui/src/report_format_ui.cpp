@@ -13,6 +13,7 @@
 #include <dlfcn.h>
 #endif
 
+#include "common/c_logger.h"
 #include "common/config_format/c_configuration.h"
 #include "common/config_format/c_configuration_report_module.h"
 #include "common/qc4openx_filesystem.h"
@@ -58,8 +59,7 @@ int main(int argc, char *argv[])
         {
             if (stat(strFilepath.c_str(), &fileStatus) == -1) // ==0 ok; ==-1 error
             {
-                std::cerr << "Could not open file '" << strFilepath << "'!" << std::endl
-                          << "Abort generating report!" << std::endl;
+                LogError() << "Could not open file '" << strFilepath << "'!\nAbort generating report!";
                 return -1;
             }
 
@@ -69,10 +69,10 @@ int main(int argc, char *argv[])
         {
             cConfiguration configuration;
 
-            std::cout << "Config: " << strFilepath << std::endl;
+            LogInfo() << "Config: " << strFilepath;
             if (!cConfiguration::ParseFromXML(&configuration, strFilepath))
             {
-                std::cerr << "Could not read configuration! Abort." << std::endl;
+                LogError() << "Could not read configuration! Abort.";
                 return -1;
             }
 
@@ -82,8 +82,8 @@ int main(int argc, char *argv[])
             if (nullptr != reportModuleConfig)
                 inputParams.Overwrite(reportModuleConfig->GetParams());
             else
-                std::cerr << "No configuration for module '" << REPORT_MODULE_NAME
-                          << "' found. Start with default params." << std::endl;
+                LogWarning() << "No configuration for module '" << REPORT_MODULE_NAME
+                             << "' found. Start with default params.";
         }
         else if (StringEndsWith(ToLower(strFilepath), "--defaultconfig"))
         {
@@ -134,7 +134,7 @@ int RunReportGUI(const cParameterContainer &inputParams, const QApplication &app
     {
         try
         {
-            std::cout << "Read result file: '" << strXMLResultsPath << "' ..." << std::endl << std::endl;
+            LogInfo() << "Read result file: '" << strXMLResultsPath << "' ...\n";
             pResultContainer->AddResultsFromXML(strXMLResultsPath);
         }
         catch (...)
@@ -142,7 +142,7 @@ int RunReportGUI(const cParameterContainer &inputParams, const QApplication &app
         }
     }
 
-    std::cout << "Prepare UI..." << std::endl << std::endl;
+    LogInfo() << "Prepare UI...\n";
     std::string report_gui_name = REPORT_MODULE_NAME;
     std::string build_version = BUILD_VERSION;
     std::string build_date = BUILD_DATE;
@@ -169,9 +169,8 @@ void WriteDefaultConfig()
     std::stringstream ssConfigFile;
     ssConfigFile << REPORT_MODULE_NAME << ".xml";
 
-    std::cout << std::endl;
-    std::cout << "Write default config: '" << ssConfigFile.str() << "'" << std::endl << std::endl;
+    LogInfo() << "\nWrite default config: '" << ssConfigFile.str() << "'\n";
     defaultConfig.WriteConfigurationToFile(ssConfigFile.str());
 
-    std::cout << "Finished." << std::endl;
+    LogInfo() << "Finished.";
 }
@@ -8,30 +8,74 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 #include "c_checker_widget.h"
+#include "c_issue_filter_model.h"
+#include "c_issue_search_index.h"
+#include "c_issue_tree_model.h"
 
-#include <QtCore/QMap>
 #include <QtCore/QTextStream>
+#include <QtCore/QThread>
 #include <QtWidgets/QHeaderView>
 #include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
 #include <QtWidgets/QMessageBox>
 #include <QtWidgets/QSplitter>
 #include <QtWidgets/QTextEdit>
+#include <QtWidgets/QTreeView>
 #include <QtWidgets/QTreeWidget>
 #include <QtWidgets/QVBoxLayout>
 
+#include "common/c_logger.h"
 #include "common/result_format/c_checker.h"
 #include "common/result_format/c_checker_bundle.h"
 #include "common/result_format/c_file_location.h"
 #include "common/result_format/c_inertial_location.h"
-#include "common/result_format/c_time_location.h"
-#include "common/result_format/c_message_location.h"
 #include "common/result_format/c_issue.h"
 #include "common/result_format/c_locations_container.h"
 #include "common/result_format/c_result_container.h"
-#include "common/result_format/c_xml_location.h"
 
 #include "common/util.h"
 
+#include <atomic>
+
+static const char *const STR_SEARCH_PLACEHOLDER = "Search descriptions, rule UIDs, checkers and XPaths";
+static const char *const STR_SEARCH_INDEXING = "Indexing issues...";
+
+/*
+ * Thread which builds the search index of a list of issues
+ */
+class cIssueSearchIndexBuilder : public QThread
+{
+  public:
+    cIssueSearchIndexBuilder(const std::vector<cIssue *> &issues, QObject *parent)
+        : QThread(parent), m_Issues(issues), m_Index(new cIssueSearchIndex()), m_Cancelled(false)
+    {
+    }
+
+    void Cancel()
+    {
+        m_Cancelled = true;
+    }
+
+    // Returns the index and passes the ownership to the caller. Only valid after the thread has finished.
+    cIssueSearchIndex *TakeIndex()
+    {
+        return m_Index.release();
+    }
+
+  protected:
+    void run() override
+    {
+        m_Index->Build(m_Issues, m_Cancelled);
+    }
+
+  private:
+    // The issues are copied, because the filter may be replaced while the index is built
+    std::vector<cIssue *> m_Issues;
+    std::unique_ptr<cIssueSearchIndex> m_Index;
+
+    std::atomic<bool> m_Cancelled;
+};
+
 cCheckerWidget::cCheckerWidget(QWidget *parent) : QWidget(parent)
 {
     QFont font;
@@ -97,8 +141,15 @@ cCheckerWidget::cCheckerWidget(QWidget *parent) : QWidget(parent)
     QLabel *issueWidgetLabel = new QLabel(issueWidget);
     issueWidgetLabel->setText("Issues");
     issueWidgetLabel->setStyleSheet("font-weight: bold;");
-    _issueBox = new QTreeWidget(this);
-    _issueBox->setColumnCount(4);
+    _searchEdit = new QLineEdit(issueWidget);
+    _searchEdit->setPlaceholderText(STR_SEARCH_PLACEHOLDER);
+    _searchEdit->setClearButtonEnabled(true);
+    // The issue view is backed by a model, so only the visible rows are created. The proxy applies the issue filter.
+    _issueModel = new cIssueTreeModel(this);
+    _issueFilterModel = new cIssueFilterModel(_issueModel, this);
+    _issueBox = new QTreeView(this);
+    _issueBox->setModel(_issueFilterModel);
+    _issueBox->setUniformRowHeights(true);
     _issueBox->setSortingEnabled(false);
     _issueBox->setContentsMargins(QMargins(0, 0, 0, 0));
     _issueBox->setAlternatingRowColors(true);
@@ -107,18 +158,13 @@ cCheckerWidget::cCheckerWidget(QWidget *parent) : QWidget(parent)
     _issueBox->setColumnWidth(0, 35);
     _issueBox->setRootIsDecorated(false);
 
-    QTreeWidgetItem *headerItem = new QTreeWidgetItem();
-    headerItem->setText(0, "ID");
-    headerItem->setText(2, "Level");
-    headerItem->setText(3, "Description");
-    _issueBox->setHeaderItem(headerItem);
-
     _issueBox->header()->resizeSection(0, 55);
     _issueBox->header()->resizeSection(1, 32);
     _issueBox->header()->resizeSection(2, 40);
     _issueBox->header()->setDefaultAlignment(Qt::AlignLeft);
 
     issueWidgetLayout->addWidget(issueWidgetLabel);
+    issueWidgetLayout->addWidget(_searchEdit);
     issueWidgetLayout->addWidget(_issueBox, 0);
     issueWidgetLayout->setContentsMargins(3, 3, 3, 3);
     issueWidget->setLayout(issueWidgetLayout);
@@ -156,7 +202,8 @@ cCheckerWidget::cCheckerWidget(QWidget *parent) : QWidget(parent)
     connect(_checkerBundleBox, SIGNAL(itemClicked(QTreeWidgetItem *, int)),
             SLOT(OnClickCheckerBundle(QTreeWidgetItem *, int)));
     connect(_checkerBox, SIGNAL(itemClicked(QTreeWidgetItem *, int)), SLOT(OnClickChecker(QTreeWidgetItem *, int)));
-    connect(_issueBox, SIGNAL(itemClicked(QTreeWidgetItem *, int)), SLOT(OnClickIssue(QTreeWidgetItem *, int)));
+    connect(_issueBox, SIGNAL(clicked(const QModelIndex &)), SLOT(OnClickIssue(const QModelIndex &)));
+    connect(_searchEdit, SIGNAL(textChanged(const QString &)), SLOT(OnSearchTextChanged(const QString &)));
 
     layout->addWidget(splitter);
     setLayout(layout);
@@ -164,16 +211,21 @@ cCheckerWidget::cCheckerWidget(QWidget *parent) : QWidget(parent)
     _currentResultContainer = nullptr;
 }
 
-void cCheckerWidget::UpdateResultContainer(cResultContainer *const container)
+cCheckerWidget::~cCheckerWidget()
 {
-    _currentResultContainer = container;
-
-    LoadAllItems();
+    StopSearchIndex();
 }
 
-void cCheckerWidget::LoadResultContainer(cResultContainer *const container)
+void cCheckerWidget::LoadResultContainer(cResultContainer *const container, cIssueFilter *filter)
 {
-    UpdateResultContainer(container);
+    StopSearchIndex();
+
+    _currentResultContainer = container;
+    _issueFilter = filter;
+    _issueDetails.clear();
+
+    LoadAllItems();
+    StartSearchIndex();
 
     // Show XODR and highlight issues
     if (container->HasCheckerBundles())
@@ -212,16 +264,14 @@ void cCheckerWidget::LoadCheckerBundles(std::list<cCheckerBundle *> checkerBundl
     selectAllEntry->setToolTip(0, "No parameters available.");
     _checkerBundleBox->addTopLevelItem(selectAllEntry);
 
+    // Bundles without shown issues are hidden, so they can reappear when the filter changes
     for (std::list<cCheckerBundle *>::const_iterator it = checkerBundles.cbegin(); it != checkerBundles.cend(); it++)
     {
-        if ((*it)->GetEnabledIssuesCount() == 0)
-        {
-            continue;
-        }
         QTreeWidgetItem *newBundleItem = new QTreeWidgetItem(_checkerBundleBox);
 
         FillCheckerBundleTreeItem(newBundleItem, *it);
         _checkerBundleBox->addTopLevelItem(newBundleItem);
+        newBundleItem->setHidden(_issueFilter->CountVisible(_issueFilter->GetRange(*it)) == 0);
     }
 }
 
@@ -231,62 +281,160 @@ void cCheckerWidget::LoadCheckers(std::list<cChecker *> checkers) const
 
     for (std::list<cChecker *>::const_iterator it = checkers.cbegin(); it != checkers.cend(); it++)
     {
-        // Display checkers only if there are more then 0 issues.
-        if ((*it)->GetIssueCount() > 0 && (*it)->GetEnabledIssuesCount() > 0)
+        // Display checkers only if there are more then 0 issues. Checkers without shown issues are hidden.
+        if ((*it)->GetIssueCount() > 0)
         {
             QTreeWidgetItem *newItem = new QTreeWidgetItem(_checkerBox);
 
             FillCheckerTreeItem(newItem, *it);
             _checkerBox->addTopLevelItem(newItem);
+            newItem->setHidden(_issueFilter->CountVisible(_issueFilter->GetRange(*it)) == 0);
         }
     }
 }
 
-void cCheckerWidget::LoadIssues(std::list<cIssue *> issues) const
+void cCheckerWidget::LoadIssues(const cIssueFilter::tRange &range) const
 {
-    _issueBox->clear();
+    _issueModel->SetIssues(_issueFilter, range);
 
-    for (std::list<cIssue *>::const_iterator it = issues.cbegin(); it != issues.cend(); it++)
-    {
-        if (!(*it)->IsEnabled())
-        {
-            continue;
-        }
-        QTreeWidgetItem *newItem = new QTreeWidgetItem(_issueBox);
+    _issueDetailsTextWidget->clear();
 
-        FillIssueTreeItem(newItem, *it);
-        _issueBox->addTopLevelItem(newItem);
+    if (range.second > range.first)
+        SelectFirstIssue();
+    else
+    {
+        // The model shows a placeholder row without issues
+        _issueBox->setCurrentIndex(_issueFilterModel->index(0, 0));
+        _issueDetailsTextWidget->setText(QString("No issues found in selected xqar file"));
+        QMessageBox msgBox;
+        msgBox.setWindowTitle("Result file info");
+        msgBox.setStandardButtons(QMessageBox::Ok);
+        msgBox.setText("No issues found in selected xqar file");
+        msgBox.exec();
     }
 
-    _issueDetailsTextWidget->clear();
+    ExpandIssues();
+}
 
-    if (issues.size() > 0)
+void cCheckerWidget::SelectFirstIssue() const
+{
+    cIssue *firstIssue = _issueModel->GetIssue(_issueFilterModel->mapToSource(_issueFilterModel->index(0, 0)));
+    if (nullptr != firstIssue)
     {
-        cIssue *firstIssue = issues.front();
         SelectIssue(firstIssue);
         ShowIssue(firstIssue, nullptr);
     }
+}
 
-    if (issues.size() == 0)
+void cCheckerWidget::ExpandIssues() const
+{
+    // Expanding creates the rows of all locations, so it is left to the user for long lists
+    if (_issueFilterModel->rowCount() <= MAX_EXPANDED_ISSUES)
     {
-        QTreeWidgetItem *newItem = new QTreeWidgetItem(_issueBox);
-
-        newItem->setToolTip(0, "Identifier");
-        newItem->setText(0, QString("-"));
-        newItem->setText(1, QString("-"));
-        newItem->setText(2, QString("-"));
-        newItem->setText(3, QString("No Issues Found"));
-        _issueBox->setItemSelected(newItem, true);
-        _issueDetailsTextWidget->setText(QString("No issues found in selected xqar file"));
-        _issueBox->addTopLevelItem(newItem);
-        QMessageBox msgBox;
-        msgBox.setWindowTitle("Result file info");
-        msgBox.setStandardButtons(QMessageBox::Ok);
-        msgBox.setText("No issues found in selected xqar file");
-        msgBox.exec();
+        _issueBox->setRootIsDecorated(false);
+        _issueBox->expandAll();
     }
+    else
+        _issueBox->setRootIsDecorated(true);
+}
 
-    _issueBox->expandAll();
+void cCheckerWidget::UpdateFilter()
+{
+    if (nullptr == _issueFilter)
+        return;
+
+    _issueFilterModel->UpdateFilter();
+    UpdateItemVisibility();
+    ExpandIssues();
+
+    // The selected issue may be hidden now
+    if (!_issueBox->currentIndex().isValid())
+    {
+        _issueDetailsTextWidget->clear();
+        SelectFirstIssue();
+    }
+}
+
+void cCheckerWidget::UpdateItemVisibility() const
+{
+    for (int i = 0; i < _checkerBundleBox->topLevelItemCount(); ++i)
+    {
+        QTreeWidgetItem *item = _checkerBundleBox->topLevelItem(i);
+        cCheckerBundle *checkerBundle = item->data(0, CHECKER_BUNDLE_DATA).value<cCheckerBundle *>();
+
+        // The "Select All" entry has no bundle
+        if (nullptr != checkerBundle)
+            item->setHidden(_issueFilter->CountVisible(_issueFilter->GetRange(checkerBundle)) == 0);
+    }
+
+    for (int i = 0; i < _checkerBox->topLevelItemCount(); ++i)
+    {
+        QTreeWidgetItem *item = _checkerBox->topLevelItem(i);
+        cChecker *checker = item->data(0, CHECKER_DATA).value<cChecker *>();
+
+        if (nullptr != checker)
+            item->setHidden(_issueFilter->CountVisible(_issueFilter->GetRange(checker)) == 0);
+    }
+}
+
+void cCheckerWidget::StartSearchIndex()
+{
+    _searchEdit->setPlaceholderText(STR_SEARCH_INDEXING);
+
+    _searchIndexBuilder = new cIssueSearchIndexBuilder(_issueFilter->GetIssues(), this);
+    connect(_searchIndexBuilder, &QThread::finished, this, &cCheckerWidget::OnSearchIndexBuilt);
+    _searchIndexBuilder->start();
+}
+
+void cCheckerWidget::StopSearchIndex()
+{
+    if (nullptr != _searchIndexBuilder)
+    {
+        _searchIndexBuilder->Cancel();
+        _searchIndexBuilder->wait();
+        delete _searchIndexBuilder;
+        _searchIndexBuilder = nullptr;
+    }
+
+    _searchIndex.reset();
+}
+
+void cCheckerWidget::OnSearchIndexBuilt()
+{
+    // Ignore builders which were stopped in the meantime
+    if (nullptr == _searchIndexBuilder || sender() != _searchIndexBuilder || !_searchIndexBuilder->isFinished())
+        return;
+
+    _searchIndex.reset(_searchIndexBuilder->TakeIndex());
+
+    _searchIndexBuilder->deleteLater();
+    _searchIndexBuilder = nullptr;
+
+    _searchEdit->setPlaceholderText(STR_SEARCH_PLACEHOLDER);
+
+    // Text which was entered while the index was built is searched now
+    ApplySearch();
+}
+
+void cCheckerWidget::OnSearchTextChanged(const QString &)
+{
+    ApplySearch();
+}
+
+void cCheckerWidget::ApplySearch()
+{
+    if (nullptr == _issueFilter || nullptr == _searchIndex)
+        return;
+
+    cIssueFilter::tBitset matches;
+    if (_searchIndex->Search(_searchEdit->text().toStdString(), matches))
+        _issueFilter->SetMatches(std::move(matches));
+    else if (_issueFilter->HasMatches())
+        _issueFilter->ClearMatches();
+    else
+        return;
+
+    UpdateFilter();
 }
 
 void cCheckerWidget::FillCheckerBundleTreeItem(QTreeWidgetItem *treeItem, cCheckerBundle *const bundle) const
@@ -351,120 +499,6 @@ void cCheckerWidget::FillParameters(QTreeWidgetItem *treeItem, cParameterContain
     }
 }
 
-void cCheckerWidget::FillIssueTreeItem(QTreeWidgetItem *treeItem, cIssue *const issue) const
-{
-    treeItem->setToolTip(0, "Identifier");
-    treeItem->setText(0, QString::number(issue->GetIssueId()));
-    treeItem->setData(1, ISSUE_DATA, issue->GetIssueId());
-    treeItem->setData(1, ISSUE_EXTENDED_DATA, false);
-    treeItem->setChildIndicatorPolicy(QTreeWidgetItem::DontShowIndicatorWhenChildless);
-
-    if (issue->HasLocations())
-    {
-        bool isVisibleInViewer = false;
-        bool isVisibleInFileView = false;
-
-        for (const auto subIssue : issue->GetLocationsContainer())
-        {
-            if (subIssue->HasExtendedInformation<cInertialLocation *>())
-            {
-                isVisibleInViewer = true;
-            }
-
-            if (subIssue->HasExtendedInformation<cFileLocation *>())
-            {
-                isVisibleInFileView = true;
-            }
-        }
-
-        if (isVisibleInFileView)
-        {
-            if (isVisibleInViewer)
-            {
-                treeItem->setSizeHint(1, QSize(35, 30));
-                treeItem->setIcon(1, QIcon(":/icons/marked_visible.png"));
-                treeItem->setToolTip(1, "Issue is marked in XML view and visible in XODR viewer");
-            }
-            else
-            {
-                treeItem->setSizeHint(1, QSize(35, 30));
-                treeItem->setIcon(1, QIcon(":/icons/marked.png"));
-                treeItem->setToolTip(1, "Issue is marked in XML view");
-            }
-        }
-        else
-        {
-            if (isVisibleInViewer)
-            {
-                treeItem->setSizeHint(1, QSize(35, 30));
-                treeItem->setIcon(1, QIcon(":/icons/visible.png"));
-                treeItem->setToolTip(1, "Issue is visible in XODR viewer");
-            }
-        }
-    }
-    else
-    {
-        treeItem->setSizeHint(1, QSize(35, 30));
-        treeItem->setIcon(1, QIcon(":/icons/issue.png"));
-        treeItem->setToolTip(1, "Issue is not marked in XML view and not visible in XODR viewer");
-    }
-
-    treeItem->setSizeHint(2, QSize(35, 30));
-    if (issue->GetIssueLevel() == INFO_LVL)
-    {
-        treeItem->setIcon(2, QIcon(":/icons/green.png"));
-        treeItem->setToolTip(2, "Information");
-    }
-    else if (issue->GetIssueLevel() == WARNING_LVL)
-    {
-        treeItem->setIcon(2, QIcon(":/icons/yellow.png"));
-        treeItem->setToolTip(2, "Warning");
-    }
-    else
-    {
-        treeItem->setIcon(2, QIcon(":/icons/red.png"));
-        treeItem->setToolTip(2, "Error");
-    }
-
-    std::stringstream ssItemDesc;
-    ssItemDesc << issue->GetDescription();
-
-    // Add extended informations to report GUI if we have them
-    if (issue->HasLocations())
-    {
-        int i = 0;
-        for (const auto location : issue->GetLocationsContainer())
-        {
-            std::stringstream ssDesc;
-            ssDesc << location->GetDescription();
-
-            if (location->HasExtendedInformations())
-            {
-                for (auto xItem : location->GetExtendedInformations())
-                {
-                    PrintExtendedInformationIntoStream(xItem, &ssDesc);
-                }
-            }
-
-            QTreeWidgetItem *extendedIssueSubItem = new QTreeWidgetItem(_issueBox);
-
-            extendedIssueSubItem->setData(1, ISSUE_DATA, issue->GetIssueId());
-            extendedIssueSubItem->setData(1, ISSUE_EXTENDED_DATA, true);
-            extendedIssueSubItem->setData(1, ISSUE_EXTENDED_DESCRIPTION, QString(location->GetDescription().c_str()));
-            extendedIssueSubItem->setData(1, ISSUE_ORDER, i);
-            extendedIssueSubItem->setText(3, ssDesc.str().c_str());
-
-            treeItem->addChild(extendedIssueSubItem);
-
-            ++i;
-        }
-    }
-
-    treeItem->setText(3, ssItemDesc.str().c_str());
-    treeItem->setToolTip(3, ssItemDesc.str().c_str());
-    treeItem->setFirstColumnSpanned(false);
-}
-
 void cCheckerWidget::SelectCheckerBundle(cCheckerBundle *checkerBundle) const
 {
     if (nullptr == checkerBundle)
@@ -516,18 +550,13 @@ void cCheckerWidget::SelectIssue(cIssue *issue) const
     if (nullptr == issue)
         return;
 
-    for (int i = 0; i < _issueBox->topLevelItemCount(); ++i)
-    {
-        QTreeWidgetItem *item = _issueBox->topLevelItem(i);
+    QModelIndex index = _issueFilterModel->mapFromSource(_issueModel->IndexOf(issue));
+    if (!index.isValid())
+        return;
 
-        if (item->data(1, ISSUE_DATA).toLongLong() == issue->GetIssueId())
-        {
-            _issueBox->clearSelection();
-            _issueBox->setItemSelected(item, true);
-            _issueBox->scrollToItem(item);
-            return;
-        }
-    }
+    _issueBox->clearSelection();
+    _issueBox->setCurrentIndex(index);
+    _issueBox->scrollTo(index);
 }
 
 void cCheckerWidget::OnClickCheckerBundle(QTreeWidgetItem *item, int)
@@ -555,10 +584,9 @@ void cCheckerWidget::OnClickCheckerBundle(QTreeWidgetItem *item, int)
             return;
 
         std::list<cChecker *> resultCheckers = _currentResultContainer->GetCheckers(checkerBundleData->GetBundleName());
-        std::list<cIssue *> resultIssues = _currentResultContainer->GetIssues(resultCheckers);
 
         LoadCheckers(resultCheckers);
-        LoadIssues(resultIssues);
+        LoadIssues(_issueFilter->GetRange(checkerBundleData));
     }
 }
 
@@ -571,8 +599,7 @@ void cCheckerWidget::OnClickChecker(QTreeWidgetItem *item, int)
 
     if (nullptr != checker)
     {
-        std::list<cIssue *> resultIssues = _currentResultContainer->GetIssues(checker);
-        LoadIssues(resultIssues);
+        LoadIssues(_issueFilter->GetRange(checker));
 
         if (nullptr != checker->GetCheckerBundle())
         {
@@ -581,47 +608,36 @@ void cCheckerWidget::OnClickChecker(QTreeWidgetItem *item, int)
     }
 }
 
-void cCheckerWidget::OnClickIssue(QTreeWidgetItem *item, int col)
+void cCheckerWidget::OnClickIssue(const QModelIndex &proxyIndex)
 {
     if (nullptr == _currentResultContainer)
         return;
 
+    const QModelIndex index = _issueFilterModel->mapToSource(proxyIndex);
+
     // Retrieve the issue
-    cIssue *issue = _currentResultContainer->GetIssueById(item->data(1, ISSUE_DATA).toLongLong());
+    cIssue *issue = _issueModel->GetIssue(index);
 
     if (nullptr != issue)
     {
         // If we have an extended item...
-        if (item->data(1, ISSUE_EXTENDED_DATA).toBool())
+        if (_issueModel->IsLocation(index))
         {
-            int clickedLocation = item->data(1, ISSUE_ORDER).toInt();
-            QMap<int, QList<cExtendedInformation *>> groupedExpandedtems;
-            cLocationsContainer *locationPtr = nullptr;
+            cLocationsContainer *location = _issueModel->GetLocation(index);
 
-            // locationscontainer has a LIST... so we can't just use []operator here *doh*
-            int i = 0;
-            for (const auto location : issue->GetLocationsContainer())
+            if (nullptr != location && location->HasExtendedInformations())
             {
-                if (location->HasExtendedInformations() && i == clickedLocation)
+                QList<cExtendedInformation *> extendedItems;
+                for (auto xItem : location->GetExtendedInformations())
                 {
-                    groupedExpandedtems[i] = QList<cExtendedInformation *>();
-                    for (auto xItem : location->GetExtendedInformations())
-                    {
-                        groupedExpandedtems[i].append(xItem);
-                    }
-                    locationPtr = location;
+                    extendedItems.append(xItem);
                 }
-                ++i;
-            }
 
-            if (groupedExpandedtems.contains(clickedLocation))
-            {
-                ShowIssue(issue, locationPtr, groupedExpandedtems[clickedLocation]);
+                ShowIssue(issue, location, extendedItems);
             }
             else
             {
-                std::cout << "Cannot find extended information group with identifier. Abort." << clickedLocation
-                          << std::endl;
+                LogError() << "Cannot find extended information group with identifier. Abort." << index.row();
             }
         }
         else
@@ -650,193 +666,158 @@ void cCheckerWidget::ShowIssue(cIssue *const itemToShow, const cLocationsContain
                 hasInputPath = true;
         }
 
+        QList<int> rows;
+
         // Evaluate extended information groups for more sophisticated reports
-        if (extendedInformationGroup.count() > 0)
+        for (cExtendedInformation *extInfo : extendedInformationGroup)
         {
-            for (cExtendedInformation *extInfo : extendedInformationGroup)
-            {
-                // Show File-Locations
-                if (extInfo->IsType<cFileLocation *>())
-                {
-                    cFileLocation *fileLocation = ((cFileLocation *)extInfo);
-
-                    int row = fileLocation->GetRow();
+            // Collect File-Locations
+            if (extInfo->IsType<cFileLocation *>())
+                rows.append(((cFileLocation *)extInfo)->GetRow());
 
-                    // If issue referes to a file, show it!
-                    if (hasInputPath)
-                        ShowInputIssue(itemToShow, row);
-                }
+            // Show InertialLocations in Viewer
+            if (extInfo->IsType<cInertialLocation *>())
+            {
+                ShowIssueIn3DViewer(itemToShow, locationToShow);
+            }
+        }
 
-                // Show InertialLocations in Viewer
-                if (extInfo->IsType<cInertialLocation *>())
+        // Without a selected location, all File-Locations of the issue are shown
+        if (extendedInformationGroup.count() == 0)
+        {
+            for (const auto location : itemToShow->GetLocationsContainer())
+            {
+                for (auto xItem : location->GetExtendedInformations())
                 {
-                    ShowIssueIn3DViewer(itemToShow, locationToShow);
+                    if (xItem->IsType<cFileLocation *>())
+                        rows.append(((cFileLocation *)xItem)->GetRow());
                 }
             }
         }
+
+        // If issue referes to a file, show it!
+        if (hasInputPath && !rows.isEmpty())
+            ShowInputIssue(itemToShow, rows);
     }
 }
 
 void cCheckerWidget::ShowDetails(cIssue *const itemToShow) const
 {
-    if (nullptr != itemToShow)
+    if (nullptr == itemToShow)
+        return;
+
+    // The details are formatted when an issue is shown the first time
+    auto it = _issueDetails.find(itemToShow);
+    if (it == _issueDetails.end())
+        it = _issueDetails.emplace(itemToShow, CreateDetails(itemToShow)).first;
+
+    _issueDetailsTextWidget->setText(it->second);
+}
+
+QString cCheckerWidget::CreateDetails(cIssue *const itemToShow) const
+{
+    QString result;
+    QTextStream ssDetails(&result);
+    cChecker *checker = itemToShow->GetChecker();
+
+    if (nullptr != checker)
     {
-        QString result;
-        QTextStream ssDetails(&result);
-        cChecker *checker = itemToShow->GetChecker();
+        cCheckerBundle *checkerBundle = itemToShow->GetChecker()->GetCheckerBundle();
 
-        if (nullptr != checker)
+        if (nullptr != checkerBundle)
         {
-            cCheckerBundle *checkerBundle = itemToShow->GetChecker()->GetCheckerBundle();
+            ssDetails << "CheckerBundle: \t" << checkerBundle->GetBundleName().c_str() << endl;
+            ssDetails << "Build date:\t\t" << checkerBundle->GetBuildDate().c_str() << endl;
+            ssDetails << "Build version:\t" << checkerBundle->GetBuildVersion().c_str() << endl;
+            ssDetails << "Description: \t" << checkerBundle->GetDescription().c_str() << endl;
+            ssDetails << "Summary: \t\t" << checkerBundle->GetSummary().c_str() << endl;
 
-            if (nullptr != checkerBundle)
+            if (checkerBundle->HasParams())
             {
-                ssDetails << "CheckerBundle: \t" << checkerBundle->GetBundleName().c_str() << endl;
-                ssDetails << "Build date:\t\t" << checkerBundle->GetBuildDate().c_str() << endl;
-                ssDetails << "Build version:\t" << checkerBundle->GetBuildVersion().c_str() << endl;
-                ssDetails << "Description: \t" << checkerBundle->GetDescription().c_str() << endl;
-                ssDetails << "Summary: \t\t" << checkerBundle->GetSummary().c_str() << endl;
+                ssDetails << "Parameters:\t\t";
 
-                if (checkerBundle->HasParams())
-                {
-                    ssDetails << "Parameters:\t\t";
+                std::vector<std::string> checkerBundleParams = checkerBundle->GetParams();
+                std::vector<std::string>::const_iterator itCheckerBundleParams = checkerBundleParams.begin();
 
-                    std::vector<std::string> checkerBundleParams = checkerBundle->GetParams();
-                    std::vector<std::string>::const_iterator itCheckerBundleParams = checkerBundleParams.begin();
+                ssDetails << (*itCheckerBundleParams).c_str() << " = "
+                          << checkerBundle->GetParam(*itCheckerBundleParams).c_str();
+                itCheckerBundleParams++;
 
-                    ssDetails << (*itCheckerBundleParams).c_str() << " = "
+                for (; itCheckerBundleParams != checkerBundleParams.end(); itCheckerBundleParams++)
+                {
+                    ssDetails << "\n\t\t\t\t" << (*itCheckerBundleParams).c_str() << " = "
                               << checkerBundle->GetParam(*itCheckerBundleParams).c_str();
-                    itCheckerBundleParams++;
-
-                    for (; itCheckerBundleParams != checkerBundleParams.end(); itCheckerBundleParams++)
-                    {
-                        ssDetails << "\n\t\t\t\t" << (*itCheckerBundleParams).c_str() << " = "
-                                  << checkerBundle->GetParam(*itCheckerBundleParams).c_str();
-                    }
-                    ssDetails << endl;
                 }
+                ssDetails << endl;
             }
+        }
 
-            ssDetails << endl;
-            ssDetails << "Checker: \t\t" << checker->GetCheckerID().c_str() << endl;
-            ssDetails << "Description: \t" << checker->GetDescription().c_str() << endl;
+        ssDetails << endl;
+        ssDetails << "Checker: \t\t" << checker->GetCheckerID().c_str() << endl;
+        ssDetails << "Description: \t" << checker->GetDescription().c_str() << endl;
 
-            if (checker->HasParams())
-            {
-                ssDetails << "Parameters:\t\t";
+        if (checker->HasParams())
+        {
+            ssDetails << "Parameters:\t\t";
 
-                std::vector<std::string> checkerParams = checker->GetParams();
-                std::vector<std::string>::const_iterator itCheckerParams = checkerParams.begin();
+            std::vector<std::string> checkerParams = checker->GetParams();
+            std::vector<std::string>::const_iterator itCheckerParams = checkerParams.begin();
 
-                ssDetails << (*itCheckerParams).c_str() << " = " << checker->GetParam(*itCheckerParams).c_str();
-                itCheckerParams++;
+            ssDetails << (*itCheckerParams).c_str() << " = " << checker->GetParam(*itCheckerParams).c_str();
+            itCheckerParams++;
 
-                for (; itCheckerParams != checkerParams.end(); itCheckerParams++)
-                {
-                    ssDetails << "\n\t\t\t\t" << (*itCheckerParams).c_str() << " = "
-                              << checker->GetParam(*itCheckerParams).c_str();
-                }
-                ssDetails << endl;
+            for (; itCheckerParams != checkerParams.end(); itCheckerParams++)
+            {
+                ssDetails << "\n\t\t\t\t" << (*itCheckerParams).c_str() << " = "
+                          << checker->GetParam(*itCheckerParams).c_str();
             }
             ssDetails << endl;
         }
+        ssDetails << endl;
+    }
 
-        ssDetails << itemToShow->GetIssueLevelStr().c_str() << " | " << itemToShow->GetDescription().c_str();
-        if (itemToShow->GetRuleUID() != "")
-        {
-            ssDetails << "\nruleUID: ";
-            ssDetails << itemToShow->GetRuleUID().c_str();
-        }
+    ssDetails << itemToShow->GetIssueLevelStr().c_str() << " | " << itemToShow->GetDescription().c_str();
+    if (itemToShow->GetRuleUID() != "")
+    {
+        ssDetails << "\nruleUID: ";
+        ssDetails << itemToShow->GetRuleUID().c_str();
+    }
 
-        // Add extended informations to description if present
-        std::stringstream extended_info_stream;
-        if (itemToShow->HasLocations())
+    // Add extended informations to description if present
+    std::stringstream extended_info_stream;
+    if (itemToShow->HasLocations())
+    {
+        extended_info_stream << "\n - Extended information:";
+        for (const auto location : itemToShow->GetLocationsContainer())
         {
-            extended_info_stream << "\n - Extended information:";
-            for (const auto location : itemToShow->GetLocationsContainer())
-            {
 
-                if (location->HasExtendedInformations())
+            if (location->HasExtendedInformations())
+            {
+                for (auto xItem : location->GetExtendedInformations())
                 {
-                    for (auto xItem : location->GetExtendedInformations())
-                    {
-                        PrintExtendedInformationIntoStream(xItem, &extended_info_stream);
-                    }
+                    cIssueTreeModel::PrintExtendedInformationIntoStream(xItem, &extended_info_stream);
                 }
             }
         }
-        if (!extended_info_stream.tellp() == std::streampos(0))
-        {
-            ssDetails << extended_info_stream.str().c_str();
-        }
-        _issueDetailsTextWidget->setText(result);
     }
+    if (!extended_info_stream.tellp() == std::streampos(0))
+    {
+        ssDetails << extended_info_stream.str().c_str();
+    }
+    ssDetails.flush();
+
+    return result;
 }
 
 void cCheckerWidget::LoadAllItems() const
 {
-    if (nullptr == _currentResultContainer)
+    if (nullptr == _currentResultContainer || nullptr == _issueFilter)
         return;
 
     std::list<cCheckerBundle *> checkerBundles = _currentResultContainer->GetCheckerBundles();
     std::list<cChecker *> checkers = _currentResultContainer->GetCheckers();
-    std::list<cIssue *> issues = _currentResultContainer->GetIssues();
 
     LoadCheckerBundles(checkerBundles);
     LoadCheckers(checkers);
-    LoadIssues(issues);
-}
-
-void cCheckerWidget::PrintExtendedInformationIntoStream(cExtendedInformation *item, std::stringstream *ssStream) const
-{
-    if (item->IsType<cFileLocation *>())
-    {
-        cFileLocation *fileLoc = (cFileLocation *)item;
-        *ssStream << std::endl << "   File:";
-        if (fileLoc->HasRowColumn())
-            *ssStream << " row=" << fileLoc->GetRow() << " column=" << fileLoc->GetColumn();
-        if (fileLoc->HasOffset())
-            *ssStream << " offset=" << fileLoc->GetOffset();
-    }
-    else if (item->IsType<cXMLLocation *>())
-    {
-        cXMLLocation *xmlLoc = (cXMLLocation *)item;
-        *ssStream << std::endl << "   XPath: " << xmlLoc->GetXPath();
-    }
-    else if (item->IsType<cInertialLocation *>())
-    {
-        cInertialLocation *initialLoc = (cInertialLocation *)item;
-
-        ssStream->setf(std::ios::fixed, std::ios::floatfield);
-        *ssStream << std::endl
-                  << "   Inertial Location: x=" << std::setprecision(2) << initialLoc->GetX()
-                  << " y=" << std::setprecision(2) << initialLoc->GetY() << " z=" << std::setprecision(2)
-                  << initialLoc->GetZ();
-    }
-    else if (item->IsType<cTimeLocation *>())
-    {
-        cTimeLocation *timeLoc = (cTimeLocation *)item;
-        *ssStream << std::endl << "   Time Location: " << timeLoc->GetTime();
-    }
-    else if (item->IsType<cMessageLocation *>())
-    {
-        cMessageLocation *messageLoc = (cMessageLocation *)item;
-        *ssStream << std::endl << "   Message Location: index=" << messageLoc->GetIndex();
-        if (messageLoc->GetChannel())
-        {
-            *ssStream << " channel=" << *messageLoc->GetChannel();
-        }
-        if (messageLoc->GetField())
-        {
-            *ssStream << " field=" << *messageLoc->GetField();
-        }
-        if (messageLoc->GetTime())
-        {
-            *ssStream << " time=" << *messageLoc->GetTime();
-        }
-    }
-    else
-    {
-        *ssStream << std::endl << "   Unknown extended information type";
-    }
+    LoadIssues(_issueFilter->GetRange());
 }
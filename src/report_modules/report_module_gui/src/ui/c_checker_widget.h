@@ -14,10 +14,17 @@
 #include <QtWidgets/QWidget>
 
 #include <iomanip>
+#include <memory>
+#include <unordered_map>
 
+#include "c_issue_filter.h"
+
+class QLineEdit;
+class QTreeView;
 class QTreeWidget;
 class QTreeWidgetItem;
 class QTextEdit;
+class QModelIndex;
 
 class cIssue;
 class cChecker;
@@ -26,6 +33,10 @@ class cExtendedInformation;
 class cParameterContainer;
 class cLocationsContainer;
 class cResultContainer;
+class cIssueTreeModel;
+class cIssueFilterModel;
+class cIssueSearchIndex;
+class cIssueSearchIndexBuilder;
 
 Q_DECLARE_OPAQUE_POINTER(cChecker *)
 Q_DECLARE_OPAQUE_POINTER(cCheckerBundle *)
@@ -48,9 +59,18 @@ class cCheckerWidget : public QWidget
     static const unsigned int ISSUE_ORDER = Qt::UserRole + 6;
 
     cCheckerWidget(QWidget *parent = 0);
+    ~cCheckerWidget();
+
+    /*
+     * Shows the results of a container.
+     * \param container: Results to show
+     * \param filter: Filter which was built for the container and decides which issues are shown. The widget sets
+     *                the search matches of the filter.
+     */
+    void LoadResultContainer(cResultContainer *const container, cIssueFilter *filter);
 
-    void LoadResultContainer(cResultContainer *const container);
-    void UpdateResultContainer(cResultContainer *const container);
+    // Applies a changed state of the issue filter. The shown lists are kept, only hidden rows change.
+    void UpdateFilter();
 
   protected:
     // Loads a list of cCheckerBundles to the widget view.
@@ -68,8 +88,26 @@ class cCheckerWidget : public QWidget
     // Selects a given cIssue in the widget view.
     void SelectIssue(cIssue *issue) const;
 
-    // Loads a list of cIssues to the widget view.
-    void LoadIssues(std::list<cIssue *> issues) const;
+    // Loads a range of the issues of the filter to the widget view.
+    void LoadIssues(const cIssueFilter::tRange &range) const;
+
+    // Selects and shows the first issue which passes the filter
+    void SelectFirstIssue() const;
+
+    // Expands the locations of the shown issues, if there are not too many of them
+    void ExpandIssues() const;
+
+    // Hides the checker bundles and checkers without issues which pass the filter
+    void UpdateItemVisibility() const;
+
+    // Starts building the search index of the issues of the filter on a background thread
+    void StartSearchIndex();
+
+    // Stops building the search index and removes the index
+    void StopSearchIndex();
+
+    // Restricts the filter to the matches of the search text
+    void ApplySearch();
 
     // Reset the widget view to default
     void LoadAllItems() const;
@@ -83,10 +121,10 @@ class cCheckerWidget : public QWidget
     // Show details of an issue
     void ShowDetails(cIssue *const itemToShow) const;
 
-  protected:
-    // Fills an issue tree item
-    void FillIssueTreeItem(QTreeWidgetItem *treeItem, cIssue *const issue) const;
+    // Formats the details of an issue, its checker and its checker bundle
+    QString CreateDetails(cIssue *const itemToShow) const;
 
+  protected:
     // Fills an checker Bundle tree item
     void FillCheckerBundleTreeItem(QTreeWidgetItem *treeItem, cCheckerBundle *const bundle) const;
 
@@ -99,15 +137,26 @@ class cCheckerWidget : public QWidget
   private:
     QTreeWidget *_checkerBundleBox{nullptr};
     QTreeWidget *_checkerBox{nullptr};
-    QTreeWidget *_issueBox{nullptr};
+    QTreeView *_issueBox{nullptr};
+    cIssueTreeModel *_issueModel{nullptr};
+    cIssueFilterModel *_issueFilterModel{nullptr};
+    QLineEdit *_searchEdit{nullptr};
     QTextEdit *_issueDetailsTextWidget{nullptr};
 
     cResultContainer *_currentResultContainer{nullptr};
+    cIssueFilter *_issueFilter{nullptr};
+
+    // Index of the issues of the filter, nullptr while it is built
+    std::unique_ptr<cIssueSearchIndex> _searchIndex;
+    cIssueSearchIndexBuilder *_searchIndexBuilder{nullptr};
+
+    // Details of the issues which have been shown since the container was loaded
+    mutable std::unordered_map<const cIssue *, QString> _issueDetails;
 
     const std::string STR_SELECT_ALL_CHECKER_BUNDLE = "Select All";
 
-    // Prints extended informations into a stream
-    void PrintExtendedInformationIntoStream(cExtendedInformation *item, std::stringstream *ssStream) const;
+    // Up to this number of issues the locations are expanded after loading. Larger lists are expanded on demand.
+    static const int MAX_EXPANDED_ISSUES = 1000;
   public slots:
     // OnClick event for cCheckerBundle widget view
     void OnClickCheckerBundle(QTreeWidgetItem *item, int);
@@ -116,16 +165,22 @@ class cCheckerWidget : public QWidget
     void OnClickChecker(QTreeWidgetItem *item, int);
 
     // OnClick event for cIssues widget view
-    void OnClickIssue(QTreeWidgetItem *item, int);
+    void OnClickIssue(const QModelIndex &index);
+
+    // Searches the issues when the search text has changed
+    void OnSearchTextChanged(const QString &text);
+
+    // Takes the search index from the builder thread
+    void OnSearchIndexBuilt();
   signals:
     // Invoked if an resultcontainer has to be loaded
     void Load(cResultContainer *const resiltContainer) const;
 
     /*
      * Invoked if an issue will be showed.
-     * \param row: Row which should be displayed. -1 for no specific row.
+     * \param rows: Rows of the input file which should be highlighted.
      */
-    void ShowInputIssue(const cIssue *const issue, const int row) const;
+    void ShowInputIssue(const cIssue *const issue, const QList<int> &rows) const;
 
     /*
      * Invoked if an issue should be showed in 3DViewer.
@@ -0,0 +1,290 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_file_viewer.h"
+
+#include <QtCore/QThread>
+#include <QtGui/QPainter>
+#include <QtWidgets/QScrollBar>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+
+// Space between the left border and the text in pixels
+static const int TEXT_MARGIN = 4;
+
+/*
+ * Thread which collects the start offsets of all lines of a mapped file
+ */
+class cLineIndexBuilder : public QThread
+{
+  public:
+    cLineIndexBuilder(const uchar *data, qint64 size, QObject *parent)
+        : QThread(parent), m_Data(data), m_Size(size), m_MaxLineLength(0), m_Cancelled(false)
+    {
+    }
+
+    void Cancel()
+    {
+        m_Cancelled = true;
+    }
+
+    std::vector<qint64> &GetLineOffsets()
+    {
+        return m_LineOffsets;
+    }
+
+    int GetMaxLineLength() const
+    {
+        return m_MaxLineLength;
+    }
+
+  protected:
+    void run() override
+    {
+        const uchar *pos = m_Data;
+        const uchar *const end = m_Data + m_Size;
+
+        m_LineOffsets.push_back(0);
+        while (pos < end && !m_Cancelled)
+        {
+            const uchar *lineEnd = static_cast<const uchar *>(std::memchr(pos, '\n', (std::size_t)(end - pos)));
+            const uchar *next = (lineEnd != nullptr) ? lineEnd + 1 : end;
+
+            m_MaxLineLength = (int)std::max<qint64>(m_MaxLineLength, std::min<qint64>(next - pos, INT_MAX));
+            if (lineEnd != nullptr)
+                m_LineOffsets.push_back(next - m_Data);
+
+            pos = next;
+        }
+
+        // End of the last line
+        m_LineOffsets.push_back(m_Size);
+    }
+
+  private:
+    const uchar *m_Data;
+    qint64 m_Size;
+
+    std::vector<qint64> m_LineOffsets;
+    int m_MaxLineLength;
+
+    std::atomic<bool> m_Cancelled;
+};
+
+cFileViewer::cFileViewer(QWidget *parent) : QAbstractScrollArea(parent)
+{
+    verticalScrollBar()->setSingleStep(1);
+    horizontalScrollBar()->setSingleStep(1);
+}
+
+cFileViewer::~cFileViewer()
+{
+    CloseFile();
+}
+
+bool cFileViewer::OpenFile(const QString &filePath)
+{
+    CloseFile();
+
+    m_File.setFileName(filePath);
+    if (!m_File.open(QIODevice::ReadOnly))
+        return false;
+
+    m_Size = m_File.size();
+    if (m_Size > 0)
+    {
+        m_Data = m_File.map(0, m_Size);
+        if (nullptr == m_Data)
+        {
+            m_File.close();
+            m_Size = 0;
+            return false;
+        }
+    }
+
+    m_IndexBuilder = new cLineIndexBuilder(m_Data, m_Size, this);
+    connect(m_IndexBuilder, &QThread::finished, this, &cFileViewer::OnLineIndexBuilt);
+    m_IndexBuilder->start();
+
+    viewport()->update();
+    return true;
+}
+
+void cFileViewer::CloseFile()
+{
+    if (nullptr != m_IndexBuilder)
+    {
+        m_IndexBuilder->Cancel();
+        m_IndexBuilder->wait();
+        delete m_IndexBuilder;
+        m_IndexBuilder = nullptr;
+    }
+
+    if (nullptr != m_Data)
+        m_File.unmap(const_cast<uchar *>(m_Data));
+    m_File.close();
+
+    m_Data = nullptr;
+    m_Size = 0;
+    m_LineOffsets.clear();
+    m_MaxLineLength = 0;
+    m_HighlightedLines.clear();
+
+    UpdateScrollBars();
+    viewport()->update();
+}
+
+void cFileViewer::HighlightLines(const std::vector<int> &lines)
+{
+    std::set<int> highlightedLines;
+    for (int line : lines)
+    {
+        if (line >= 0)
+            highlightedLines.insert(line);
+    }
+
+    // Repaint the lines which lose or get the highlighting
+    for (int line : m_HighlightedLines)
+    {
+        if (highlightedLines.count(line) == 0)
+            UpdateLine(line);
+    }
+    for (int line : highlightedLines)
+    {
+        if (m_HighlightedLines.count(line) == 0)
+            UpdateLine(line);
+    }
+
+    m_HighlightedLines.swap(highlightedLines);
+
+    // While the index is built, the line is scrolled to when the index is available
+    if (!m_HighlightedLines.empty() && GetLineCount() > 0)
+        EnsureLineVisible(*m_HighlightedLines.begin());
+}
+
+int cFileViewer::GetLineCount() const
+{
+    return m_LineOffsets.empty() ? 0 : (int)m_LineOffsets.size() - 1;
+}
+
+void cFileViewer::paintEvent(QPaintEvent *)
+{
+    QPainter painter(viewport());
+    const QFontMetrics metrics = fontMetrics();
+
+    if (nullptr != m_IndexBuilder)
+    {
+        painter.drawText(viewport()->rect(), Qt::AlignCenter, tr("Reading file..."));
+        return;
+    }
+
+    const int lineHeight = metrics.height();
+    const int charWidth = std::max(1, metrics.width(' '));
+    const int firstLine = verticalScrollBar()->value();
+    const int firstColumn = horizontalScrollBar()->value();
+    const int columnCount = viewport()->width() / charWidth + 2;
+    const int lineCount = GetLineCount();
+
+    int y = 0;
+    for (int line = firstLine; line < lineCount && y < viewport()->height(); ++line, y += lineHeight)
+    {
+        if (m_HighlightedLines.count(line) > 0)
+            painter.fillRect(0, y, viewport()->width(), lineHeight, Qt::yellow);
+
+        painter.drawText(TEXT_MARGIN, y + metrics.ascent(), GetLineText(line, firstColumn, columnCount));
+    }
+}
+
+void cFileViewer::resizeEvent(QResizeEvent *event)
+{
+    QAbstractScrollArea::resizeEvent(event);
+    UpdateScrollBars();
+}
+
+void cFileViewer::scrollContentsBy(int, int)
+{
+    viewport()->update();
+}
+
+void cFileViewer::OnLineIndexBuilt()
+{
+    // Ignore builders which were cancelled in the meantime
+    if (nullptr == m_IndexBuilder || sender() != m_IndexBuilder || !m_IndexBuilder->isFinished())
+        return;
+
+    m_LineOffsets.swap(m_IndexBuilder->GetLineOffsets());
+    m_MaxLineLength = m_IndexBuilder->GetMaxLineLength();
+
+    m_IndexBuilder->deleteLater();
+    m_IndexBuilder = nullptr;
+
+    UpdateScrollBars();
+    if (!m_HighlightedLines.empty())
+        ScrollToLine(*m_HighlightedLines.begin());
+
+    viewport()->update();
+    emit LineCountChanged(GetLineCount());
+}
+
+void cFileViewer::UpdateScrollBars()
+{
+    const int visibleLines = GetVisibleLineCount();
+    verticalScrollBar()->setRange(0, std::max(0, GetLineCount() - visibleLines));
+    verticalScrollBar()->setPageStep(visibleLines);
+
+    const int visibleColumns = std::max(1, viewport()->width() / std::max(1, fontMetrics().width(' ')));
+    horizontalScrollBar()->setRange(0, std::max(0, m_MaxLineLength - visibleColumns));
+    horizontalScrollBar()->setPageStep(visibleColumns);
+}
+
+void cFileViewer::ScrollToLine(int line)
+{
+    verticalScrollBar()->setValue(line - GetVisibleLineCount() / 2);
+}
+
+void cFileViewer::EnsureLineVisible(int line)
+{
+    const int firstLine = verticalScrollBar()->value();
+    if (line < firstLine || line >= firstLine + GetVisibleLineCount())
+        ScrollToLine(line);
+}
+
+void cFileViewer::UpdateLine(int line)
+{
+    const int firstLine = verticalScrollBar()->value();
+    if (line < firstLine || line > firstLine + GetVisibleLineCount())
+        return;
+
+    const int lineHeight = fontMetrics().height();
+    viewport()->update(QRect(0, (line - firstLine) * lineHeight, viewport()->width(), lineHeight));
+}
+
+int cFileViewer::GetVisibleLineCount() const
+{
+    return std::max(1, viewport()->height() / std::max(1, fontMetrics().height()));
+}
+
+QString cFileViewer::GetLineText(int line, int firstColumn, int columnCount) const
+{
+    qint64 begin = m_LineOffsets[line];
+    qint64 end = m_LineOffsets[line + 1];
+
+    while (end > begin && (m_Data[end - 1] == '\n' || m_Data[end - 1] == '\r'))
+        --end;
+
+    // Only the visible part of long lines is decoded
+    begin = std::min(end, begin + firstColumn);
+    end = std::min(end, begin + columnCount);
+
+    QString text = QString::fromUtf8(reinterpret_cast<const char *>(m_Data) + begin, (int)(end - begin));
+    text.replace('\t', "  ");
+    return text;
+}
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef FILE_VIEWER_H
+#define FILE_VIEWER_H
+
+#include <QtCore/QFile>
+#include <QtWidgets/QAbstractScrollArea>
+
+#include <set>
+#include <vector>
+
+class cLineIndexBuilder;
+
+/*
+ * Read-only viewer for large text files. The file is memory mapped and the offsets of all lines are collected once
+ * on a background thread. Only the visible lines are decoded and painted, so the size of the file does not affect
+ * scrolling, and jumping to a line is a lookup in the line index.
+ *
+ * The viewer uses a fixed pitch font. Tabs are shown as two spaces.
+ */
+class cFileViewer : public QAbstractScrollArea
+{
+    Q_OBJECT
+
+  public:
+    cFileViewer(QWidget *parent = nullptr);
+    ~cFileViewer();
+
+    /*
+     * Shows a file. The lines are shown as soon as the line index is built.
+     * \param filePath: Path of the file
+     * \return False if the file could not be opened
+     */
+    bool OpenFile(const QString &filePath);
+
+    // Closes the shown file
+    void CloseFile();
+
+    /*
+     * Highlights lines and replaces the previous highlighting. If the first line is not visible, it is scrolled
+     * into the center of the view. Only the lines which change their highlighting are repainted.
+     * \param lines: Lines starting with 0. An empty list removes the highlighting.
+     */
+    void HighlightLines(const std::vector<int> &lines);
+
+    // Returns the number of lines, 0 while the line index is built
+    int GetLineCount() const;
+
+    // Scrolls a line into the center of the view
+    void ScrollToLine(int line);
+
+  signals:
+    // Invoked when the line index of an opened file is built
+    void LineCountChanged(int lineCount);
+
+  protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void scrollContentsBy(int dx, int dy) override;
+
+  private slots:
+    // Takes the line index from the builder thread
+    void OnLineIndexBuilt();
+
+  private:
+    // Updates the ranges of the scroll bars to the line count and the visible area
+    void UpdateScrollBars();
+
+    // Scrolls a line into the center of the view, if it is not visible
+    void EnsureLineVisible(int line);
+
+    // Repaints a line, if it is visible
+    void UpdateLine(int line);
+
+    // Returns the number of completely visible lines
+    int GetVisibleLineCount() const;
+
+    // Returns the text of a line, starting at the given column and limited to the given number of characters
+    QString GetLineText(int line, int firstColumn, int columnCount) const;
+
+    QFile m_File;
+    const uchar *m_Data{nullptr};
+    qint64 m_Size{0};
+
+    // Start offset of every line. An additional entry at the end holds the size of the file.
+    std::vector<qint64> m_LineOffsets;
+    int m_MaxLineLength{0};
+
+    cLineIndexBuilder *m_IndexBuilder{nullptr};
+
+    std::set<int> m_HighlightedLines;
+};
+
+#endif
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_issue_density_index.h"
+
+#include "common/result_format/c_file_location.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_locations_container.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+void cIssueDensityIndex::Build(const std::vector<cIssue *> &issues, const std::vector<cIssueFilter::tRange> &ranges,
+                               const std::atomic<bool> &cancelled)
+{
+    std::vector<std::pair<int, uint32_t>> locations;
+
+    m_IssueCount = issues.size();
+    m_Lines.clear();
+    m_IssueIndices.clear();
+
+    for (const cIssueFilter::tRange &range : ranges)
+    {
+        const std::size_t end = std::min(range.second, issues.size());
+
+        for (std::size_t i = range.first; i < end && !cancelled; ++i)
+        {
+            for (const auto location : issues[i]->GetLocationsContainer())
+            {
+                for (auto extendedInformation : location->GetExtendedInformations())
+                {
+                    // Rows of file locations start with 1
+                    if (extendedInformation->IsType<cFileLocation *>())
+                    {
+                        const cFileLocation *fileLocation = (cFileLocation *)extendedInformation;
+                        if (fileLocation->HasRowColumn() && fileLocation->GetRow() > 0)
+                            locations.emplace_back(fileLocation->GetRow() - 1, (uint32_t)i);
+                    }
+                }
+            }
+        }
+    }
+
+    if (cancelled)
+        return;
+
+    std::sort(locations.begin(), locations.end());
+
+    m_Lines.reserve(locations.size());
+    m_IssueIndices.reserve(locations.size());
+    for (const auto &location : locations)
+    {
+        m_Lines.push_back(location.first);
+        m_IssueIndices.push_back(location.second);
+    }
+}
+
+std::size_t cIssueDensityIndex::GetLocationCount() const
+{
+    return m_Lines.size();
+}
+
+int cIssueDensityIndex::GetLineCount() const
+{
+    return m_Lines.empty() ? 0 : m_Lines.back() + 1;
+}
+
+std::size_t cIssueDensityIndex::CountLocationsBefore(int line) const
+{
+    return (std::size_t)(std::lower_bound(m_Lines.begin(), m_Lines.end(), line) - m_Lines.begin());
+}
+
+std::size_t cIssueDensityIndex::CountLocations(int firstLine, int endLine) const
+{
+    if (endLine <= firstLine)
+        return 0;
+
+    return CountLocationsBefore(endLine) - CountLocationsBefore(firstLine);
+}
+
+void cIssueDensityIndex::GetIssues(int firstLine, int endLine, cIssueFilter::tBitset &issues) const
+{
+    issues.assign((m_IssueCount + 63) / 64, 0);
+
+    if (endLine <= firstLine)
+        return;
+
+    const std::size_t end = CountLocationsBefore(endLine);
+    for (std::size_t i = CountLocationsBefore(firstLine); i < end; ++i)
+        issues[m_IssueIndices[i] / 64] |= 1ULL << (m_IssueIndices[i] % 64);
+}
+
+std::vector<std::size_t> cIssueDensityIndex::CountLocationsPerBucket(int lineCount, int bucketCount) const
+{
+    if (lineCount <= 0 || bucketCount <= 0)
+        return {};
+
+    bucketCount = std::min(lineCount, bucketCount);
+    std::vector<std::size_t> bucketCounts(bucketCount);
+
+    std::size_t locationsBefore = 0;
+    for (int bucket = 0; bucket < bucketCount; ++bucket)
+    {
+        const std::size_t locationsAfter = CountLocationsBefore(GetBucketBegin(bucket + 1, lineCount, bucketCount));
+
+        bucketCounts[bucket] = locationsAfter - locationsBefore;
+        locationsBefore = locationsAfter;
+    }
+
+    return bucketCounts;
+}
+
+int cIssueDensityIndex::GetBucketBegin(int bucket, int lineCount, int bucketCount)
+{
+    return (int)((int64_t)bucket * lineCount / (int64_t)bucketCount);
+}
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef ISSUE_DENSITY_INDEX_H
+#define ISSUE_DENSITY_INDEX_H
+
+#include "c_issue_filter.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+class cIssue;
+
+/*
+ * Index of the file locations of issues by line of the input file.
+ *
+ * The lines of all file locations are kept in ascending order. The position of the first location at or after a line
+ * is the number of locations before that line, so the array is a prefix sum over the lines and the number of
+ * locations in any range of lines is the difference of two binary searches. The index of the issue of every location
+ * is stored in the same order, so the issues of a range of lines are a contiguous part of that list.
+ */
+class cIssueDensityIndex
+{
+  public:
+    /*
+     * Builds the index.
+     * \param issues: All issues. The indices in this list are the indices reported by GetIssues().
+     * \param ranges: Ranges of the issues which refer to the input file. Other issues are ignored.
+     * \param cancelled: Building stops early if it is set
+     */
+    void Build(const std::vector<cIssue *> &issues, const std::vector<cIssueFilter::tRange> &ranges,
+               const std::atomic<bool> &cancelled);
+
+    // Returns the number of file locations
+    std::size_t GetLocationCount() const;
+
+    // Returns the last line with a file location plus one, 0 without file locations. Lines start with 0.
+    int GetLineCount() const;
+
+    // Returns the number of file locations before a line
+    std::size_t CountLocationsBefore(int line) const;
+
+    // Returns the number of file locations in the lines [firstLine, endLine)
+    std::size_t CountLocations(int firstLine, int endLine) const;
+
+    /*
+     * Collects the issues with a file location in a range of lines.
+     * \param firstLine: First line of the range
+     * \param endLine: Line after the range
+     * \param issues: Receives one bit per issue, which is set if the issue has a location in the range
+     */
+    void GetIssues(int firstLine, int endLine, cIssueFilter::tBitset &issues) const;
+
+    /*
+     * Splits lines into buckets of about equal size and counts the file locations in each bucket.
+     * \param lineCount: Number of lines, at least GetLineCount() to count all locations
+     * \param bucketCount: Requested number of buckets. Every bucket covers at least one line, so at most lineCount
+     *                     buckets are returned.
+     * \return The number of file locations per bucket, empty if there are no lines or buckets
+     */
+    std::vector<std::size_t> CountLocationsPerBucket(int lineCount, int bucketCount) const;
+
+    // Returns the first line of a bucket of CountLocationsPerBucket(), lineCount for the bucket after the last one
+    static int GetBucketBegin(int bucket, int lineCount, int bucketCount);
+
+  private:
+    std::size_t m_IssueCount{0};
+
+    // Lines of all file locations in ascending order and the index of the issue of every location
+    std::vector<int> m_Lines;
+    std::vector<uint32_t> m_IssueIndices;
+};
+
+#endif
@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_issue_density_map.h"
+#include "c_issue_density_index.h"
+
+#include <QtCore/QThread>
+#include <QtGui/QHelpEvent>
+#include <QtGui/QMouseEvent>
+#include <QtGui/QPainter>
+#include <QtWidgets/QToolTip>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+// Height of a bucket in pixels
+static const int BUCKET_HEIGHT = 3;
+
+// Width of the strip in pixels
+static const int STRIP_WIDTH = 14;
+
+/*
+ * Thread which builds the density index of a list of issues
+ */
+class cIssueDensityIndexBuilder : public QThread
+{
+  public:
+    cIssueDensityIndexBuilder(const std::vector<cIssue *> &issues, const std::vector<cIssueFilter::tRange> &ranges,
+                              QObject *parent)
+        : QThread(parent), m_Issues(issues), m_Ranges(ranges), m_Index(new cIssueDensityIndex()), m_Cancelled(false)
+    {
+    }
+
+    void Cancel()
+    {
+        m_Cancelled = true;
+    }
+
+    // Returns the index and passes the ownership to the caller. Only valid after the thread has finished.
+    cIssueDensityIndex *TakeIndex()
+    {
+        return m_Index.release();
+    }
+
+  protected:
+    void run() override
+    {
+        m_Index->Build(m_Issues, m_Ranges, m_Cancelled);
+    }
+
+  private:
+    // The issues are copied, because the filter may be replaced while the index is built
+    std::vector<cIssue *> m_Issues;
+    std::vector<cIssueFilter::tRange> m_Ranges;
+    std::unique_ptr<cIssueDensityIndex> m_Index;
+
+    std::atomic<bool> m_Cancelled;
+};
+
+cIssueDensityMap::cIssueDensityMap(QWidget *parent) : QWidget(parent)
+{
+    setFixedWidth(STRIP_WIDTH);
+    setCursor(Qt::PointingHandCursor);
+}
+
+cIssueDensityMap::~cIssueDensityMap()
+{
+    StopIndex();
+}
+
+void cIssueDensityMap::SetIssues(const std::vector<cIssue *> &issues, const std::vector<cIssueFilter::tRange> &ranges)
+{
+    Clear();
+
+    m_IndexBuilder = new cIssueDensityIndexBuilder(issues, ranges, this);
+    connect(m_IndexBuilder, &QThread::finished, this, &cIssueDensityMap::OnIndexBuilt);
+    m_IndexBuilder->start();
+}
+
+void cIssueDensityMap::Clear()
+{
+    StopIndex();
+
+    m_FileLineCount = 0;
+    m_SelectionBegin = -1;
+    m_SelectionEnd = -1;
+
+    UpdateBuckets();
+    update();
+}
+
+void cIssueDensityMap::SetLineCount(int lineCount)
+{
+    m_FileLineCount = lineCount;
+
+    UpdateBuckets();
+    update();
+}
+
+bool cIssueDensityMap::HasSelection() const
+{
+    return m_SelectionEnd > m_SelectionBegin;
+}
+
+int cIssueDensityMap::GetSelectionBegin() const
+{
+    return m_SelectionBegin;
+}
+
+int cIssueDensityMap::GetSelectionEnd() const
+{
+    return m_SelectionEnd;
+}
+
+bool cIssueDensityMap::GetSelectedIssues(cIssueFilter::tBitset &issues) const
+{
+    if (nullptr == m_Index || !HasSelection())
+        return false;
+
+    m_Index->GetIssues(m_SelectionBegin, m_SelectionEnd, issues);
+    return true;
+}
+
+QSize cIssueDensityMap::sizeHint() const
+{
+    return QSize(STRIP_WIDTH, 0);
+}
+
+bool cIssueDensityMap::event(QEvent *event)
+{
+    if (event->type() != QEvent::ToolTip)
+        return QWidget::event(event);
+
+    QHelpEvent *helpEvent = static_cast<QHelpEvent *>(event);
+    const int bucket = GetBucketAt(helpEvent->y());
+
+    if (nullptr != m_IndexBuilder)
+        QToolTip::showText(helpEvent->globalPos(), tr("Indexing issues..."), this);
+    else if (bucket >= 0)
+        QToolTip::showText(helpEvent->globalPos(),
+                           tr("Lines %1 - %2: %3 file locations")
+                               .arg(GetBucketBegin(bucket) + 1)
+                               .arg(GetBucketBegin(bucket + 1))
+                               .arg((qulonglong)m_BucketCounts[bucket]),
+                           this);
+    else
+        QToolTip::hideText();
+
+    return true;
+}
+
+void cIssueDensityMap::paintEvent(QPaintEvent *)
+{
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().color(QPalette::Window));
+
+    const int bucketCount = (int)m_BucketCounts.size();
+    for (int bucket = 0; bucket < bucketCount; ++bucket)
+    {
+        if (m_BucketCounts[bucket] == 0)
+            continue;
+
+        // Square root scale, so single issues stay visible next to hot spots
+        const double density = std::sqrt((double)m_BucketCounts[bucket] / (double)m_MaxBucketCount);
+        const int top = bucket * height() / bucketCount;
+        const int bottom = (bucket + 1) * height() / bucketCount;
+
+        painter.fillRect(0, top, width(), std::max(1, bottom - top), QColor(255, (int)(200 * (1.0 - density)), 0));
+    }
+
+    if (HasSelection())
+    {
+        const int top = GetLineY(m_SelectionBegin);
+        const int bottom = GetLineY(m_SelectionEnd);
+
+        painter.setPen(palette().color(QPalette::Highlight));
+        painter.drawRect(0, top, width() - 1, std::max(1, bottom - top - 1));
+    }
+}
+
+void cIssueDensityMap::resizeEvent(QResizeEvent *event)
+{
+    QWidget::resizeEvent(event);
+    UpdateBuckets();
+}
+
+void cIssueDensityMap::mousePressEvent(QMouseEvent *event)
+{
+    const int bucket = GetBucketAt(event->y());
+    if (event->button() != Qt::LeftButton || bucket < 0)
+        return;
+
+    const int begin = GetBucketBegin(bucket);
+    const int end = GetBucketBegin(bucket + 1);
+
+    if (begin == m_SelectionBegin && end == m_SelectionEnd)
+    {
+        m_SelectionBegin = -1;
+        m_SelectionEnd = -1;
+    }
+    else
+    {
+        m_SelectionBegin = begin;
+        m_SelectionEnd = end;
+    }
+
+    update();
+    emit SelectionChanged();
+}
+
+void cIssueDensityMap::OnIndexBuilt()
+{
+    // Ignore builders which were stopped in the meantime
+    if (nullptr == m_IndexBuilder || sender() != m_IndexBuilder || !m_IndexBuilder->isFinished())
+        return;
+
+    m_Index.reset(m_IndexBuilder->TakeIndex());
+
+    m_IndexBuilder->deleteLater();
+    m_IndexBuilder = nullptr;
+
+    UpdateBuckets();
+    update();
+}
+
+void cIssueDensityMap::StopIndex()
+{
+    if (nullptr != m_IndexBuilder)
+    {
+        m_IndexBuilder->Cancel();
+        m_IndexBuilder->wait();
+        delete m_IndexBuilder;
+        m_IndexBuilder = nullptr;
+    }
+
+    m_Index.reset();
+}
+
+void cIssueDensityMap::UpdateBuckets()
+{
+    m_BucketCounts.clear();
+    m_MaxBucketCount = 0;
+
+    const int lineCount = GetLineCount();
+    if (nullptr == m_Index || lineCount == 0)
+        return;
+
+    m_BucketCounts = m_Index->CountLocationsPerBucket(lineCount, std::max(1, height() / BUCKET_HEIGHT));
+
+    for (const std::size_t bucketCount : m_BucketCounts)
+        m_MaxBucketCount = std::max(m_MaxBucketCount, bucketCount);
+}
+
+int cIssueDensityMap::GetLineCount() const
+{
+    return std::max(m_FileLineCount, (nullptr != m_Index) ? m_Index->GetLineCount() : 0);
+}
+
+int cIssueDensityMap::GetBucketAt(int y) const
+{
+    const int bucketCount = (int)m_BucketCounts.size();
+    if (bucketCount == 0 || y < 0 || y >= height())
+        return -1;
+
+    return std::min(bucketCount - 1, (int)((qint64)y * bucketCount / height()));
+}
+
+int cIssueDensityMap::GetBucketBegin(int bucket) const
+{
+    return cIssueDensityIndex::GetBucketBegin(bucket, GetLineCount(), (int)m_BucketCounts.size());
+}
+
+int cIssueDensityMap::GetLineY(int line) const
+{
+    const int lineCount = GetLineCount();
+    return (lineCount > 0) ? (int)((qint64)line * height() / lineCount) : 0;
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef ISSUE_DENSITY_MAP_H
+#define ISSUE_DENSITY_MAP_H
+
+#include <QtWidgets/QWidget>
+
+#include <memory>
+#include <vector>
+
+#include "c_issue_filter.h"
+
+class cIssueDensityIndex;
+class cIssueDensityIndexBuilder;
+
+/*
+ * Strip next to the input file viewer, which shows the number of file locations of the issues per range of lines.
+ *
+ * The strip covers all lines of the input file and is divided into buckets of a few pixels. The file locations are
+ * indexed on a background thread. The number of locations of every bucket is looked up in the index when the strip
+ * is resized, so painting does not depend on the number of issues. Clicking a bucket selects its lines, clicking it
+ * again removes the selection.
+ */
+class cIssueDensityMap : public QWidget
+{
+    Q_OBJECT
+
+  public:
+    cIssueDensityMap(QWidget *parent = nullptr);
+    ~cIssueDensityMap();
+
+    /*
+     * Starts indexing the file locations of issues. The selection and the line count of the input file are reset.
+     * \param issues: All issues of the filter. The issues must stay valid until the next call or Clear().
+     * \param ranges: Ranges of the issues which refer to the shown input file
+     */
+    void SetIssues(const std::vector<cIssue *> &issues, const std::vector<cIssueFilter::tRange> &ranges);
+
+    // Removes the issues and the selection
+    void Clear();
+
+    // Sets the number of lines of the input file. The strip covers at least the lines with file locations.
+    void SetLineCount(int lineCount);
+
+    // Returns true if lines are selected
+    bool HasSelection() const;
+
+    // Returns the first selected line, -1 without selection
+    int GetSelectionBegin() const;
+
+    // Returns the line after the selection, -1 without selection
+    int GetSelectionEnd() const;
+
+    /*
+     * Collects the issues with a file location in the selected lines.
+     * \param issues: Receives one bit per issue of the filter
+     * \return False if no lines are selected
+     */
+    bool GetSelectedIssues(cIssueFilter::tBitset &issues) const;
+
+    QSize sizeHint() const override;
+
+  signals:
+    // Invoked if lines were selected or the selection was removed by the user
+    void SelectionChanged();
+
+  protected:
+    bool event(QEvent *event) override;
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+
+  private slots:
+    // Takes the index from the builder thread
+    void OnIndexBuilt();
+
+  private:
+    // Stops building the index and removes the index
+    void StopIndex();
+
+    // Counts the file locations of every bucket
+    void UpdateBuckets();
+
+    // Returns the number of lines covered by the strip
+    int GetLineCount() const;
+
+    // Returns the bucket at a vertical position, -1 if there is none
+    int GetBucketAt(int y) const;
+
+    // Returns the first line of a bucket. The bucket after the last one starts at the line count.
+    int GetBucketBegin(int bucket) const;
+
+    // Returns the vertical position of a line
+    int GetLineY(int line) const;
+
+    std::unique_ptr<cIssueDensityIndex> m_Index;
+    cIssueDensityIndexBuilder *m_IndexBuilder{nullptr};
+
+    int m_FileLineCount{0};
+
+    // Number of file locations per bucket
+    std::vector<std::size_t> m_BucketCounts;
+    std::size_t m_MaxBucketCount{0};
+
+    int m_SelectionBegin{-1};
+    int m_SelectionEnd{-1};
+};
+
+#endif
@@ -0,0 +1,376 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_issue_filter.h"
+
+#include "common/result_format/c_checker.h"
+#include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_result_container.h"
+#include "common/result_format/c_result_diff.h"
+
+#include <algorithm>
+#include <bitset>
+#include <string>
+#include <unordered_set>
+
+// Fixed issues of a reference, grouped by checker bundle name and checker ID. The issues are identified by their
+// index in the list of fixed issues, which is in the order of the reference.
+typedef std::unordered_map<std::string, std::unordered_map<std::string, std::vector<std::size_t>>> tFixedIssues;
+
+void cIssueFilter::Build(cResultContainer *const container, const cResultDiff *comparison)
+{
+    m_Issues.clear();
+    m_BundleRanges.clear();
+    m_CheckerRanges.clear();
+
+    const std::vector<cIssueHandle> noIssues;
+    const std::vector<cIssueHandle> &fixedIssues = (nullptr != comparison) ? comparison->GetRemoved() : noIssues;
+
+    tFixedIssues fixedIssuesByChecker;
+    for (std::size_t i = 0; i < fixedIssues.size(); ++i)
+    {
+        const cIssueHandle &fixedIssue = fixedIssues[i];
+        fixedIssuesByChecker[fixedIssue.bundle->GetBundleName()][fixedIssue.checker->GetCheckerID()].push_back(i);
+    }
+
+    // Indices of the fixed issues in m_Issues
+    std::vector<std::size_t> fixedIndices;
+    fixedIndices.reserve(fixedIssues.size());
+
+    auto addFixedIssues = [&](std::vector<std::size_t> &indices) {
+        // Issues of several checkers are added in the order of the reference
+        std::sort(indices.begin(), indices.end());
+        for (std::size_t index : indices)
+        {
+            fixedIndices.push_back(m_Issues.size());
+            m_Issues.push_back(fixedIssues[index].issue);
+        }
+    };
+
+    for (cCheckerBundle *bundle : container->GetCheckerBundles())
+    {
+        const std::size_t bundleBegin = m_Issues.size();
+        auto fixedBundle = fixedIssuesByChecker.find(bundle->GetBundleName());
+
+        for (cChecker *checker : bundle->GetCheckers())
+        {
+            const std::size_t checkerBegin = m_Issues.size();
+
+            for (cIssue *issue : checker->GetIssues())
+                m_Issues.push_back(issue);
+
+            if (fixedBundle != fixedIssuesByChecker.end())
+            {
+                auto fixedChecker = fixedBundle->second.find(checker->GetCheckerID());
+                if (fixedChecker != fixedBundle->second.end())
+                {
+                    addFixedIssues(fixedChecker->second);
+                    fixedBundle->second.erase(fixedChecker);
+                }
+            }
+
+            m_CheckerRanges[checker] = tRange(checkerBegin, m_Issues.size());
+        }
+
+        // Fixed issues of checkers which are not in the container
+        if (fixedBundle != fixedIssuesByChecker.end())
+        {
+            std::vector<std::size_t> indices;
+            for (auto &fixedChecker : fixedBundle->second)
+                indices.insert(indices.end(), fixedChecker.second.begin(), fixedChecker.second.end());
+
+            addFixedIssues(indices);
+            fixedIssuesByChecker.erase(fixedBundle);
+        }
+
+        m_BundleRanges[bundle] = tRange(bundleBegin, m_Issues.size());
+    }
+
+    // Fixed issues of checker bundles which are not in the container
+    std::vector<std::size_t> remainingIndices;
+    for (auto &fixedBundle : fixedIssuesByChecker)
+    {
+        for (auto &fixedChecker : fixedBundle.second)
+            remainingIndices.insert(remainingIndices.end(), fixedChecker.second.begin(), fixedChecker.second.end());
+    }
+    addFixedIssues(remainingIndices);
+
+    const std::size_t wordCount = (m_Issues.size() + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    m_InfoBits.assign(wordCount, 0);
+    m_WarningBits.assign(wordCount, 0);
+    m_ErrorBits.assign(wordCount, 0);
+    m_FirstOfRuleBits.assign(wordCount, 0);
+    m_EnabledBits.assign(wordCount, 0);
+    m_NewBits.assign(wordCount, 0);
+    m_FixedBits.assign(wordCount, 0);
+
+    std::unordered_set<std::string> foundRuleUIDs;
+
+    for (std::size_t i = 0; i < m_Issues.size(); ++i)
+    {
+        const cIssue *issue = m_Issues[i];
+
+        switch (issue->GetIssueLevel())
+        {
+        case INFO_LVL:
+            SetBit(m_InfoBits, i);
+            break;
+        case WARNING_LVL:
+            SetBit(m_WarningBits, i);
+            break;
+        case ERROR_LVL:
+            SetBit(m_ErrorBits, i);
+            break;
+        }
+
+        // Issues without rule UID are never repetitive
+        const std::string &ruleUID = issue->GetRuleUID();
+        if (ruleUID == "" || ruleUID == " " || foundRuleUIDs.insert(ruleUID).second)
+            SetBit(m_FirstOfRuleBits, i);
+
+        if (issue->IsEnabled())
+            SetBit(m_EnabledBits, i);
+    }
+
+    m_HasComparison = (nullptr != comparison);
+    for (std::size_t &count : m_ComparisonCounts)
+        count = 0;
+
+    if (m_HasComparison)
+    {
+        for (std::size_t index : fixedIndices)
+            SetBit(m_FixedBits, index);
+
+        std::unordered_set<const cIssue *> newIssues;
+        newIssues.reserve(comparison->GetAdded().size());
+        for (const cIssueHandle &handle : comparison->GetAdded())
+            newIssues.insert(handle.issue);
+
+        for (std::size_t i = 0; i < m_Issues.size(); ++i)
+        {
+            if (!GetBit(m_FixedBits, i) && newIssues.count(m_Issues[i]) > 0)
+                SetBit(m_NewBits, i);
+        }
+
+        m_ComparisonCounts[NEW_ISSUE] = newIssues.size();
+        m_ComparisonCounts[FIXED_ISSUE] = fixedIndices.size();
+        m_ComparisonCounts[UNCHANGED_ISSUE] = m_Issues.size() - newIssues.size() - fixedIndices.size();
+    }
+
+    m_VisibleBits.assign(wordCount, 0);
+    m_MatchBits.clear();
+    m_HasMatches = false;
+    m_RegionBits.clear();
+    m_HasRegion = false;
+    SetState(SHOW_ALL);
+}
+
+void cIssueFilter::SetState(int state)
+{
+    m_State = state;
+    UpdateVisibleBits();
+}
+
+int cIssueFilter::GetState() const
+{
+    return m_State;
+}
+
+void cIssueFilter::SetMatches(tBitset matches)
+{
+    m_MatchBits = std::move(matches);
+    m_MatchBits.resize(m_VisibleBits.size(), 0);
+    m_HasMatches = true;
+    UpdateVisibleBits();
+}
+
+void cIssueFilter::ClearMatches()
+{
+    m_MatchBits.clear();
+    m_HasMatches = false;
+    UpdateVisibleBits();
+}
+
+bool cIssueFilter::HasMatches() const
+{
+    return m_HasMatches;
+}
+
+void cIssueFilter::SetRegion(tBitset region)
+{
+    m_RegionBits = std::move(region);
+    m_RegionBits.resize(m_VisibleBits.size(), 0);
+    m_HasRegion = true;
+    UpdateVisibleBits();
+}
+
+void cIssueFilter::ClearRegion()
+{
+    m_RegionBits.clear();
+    m_HasRegion = false;
+    UpdateVisibleBits();
+}
+
+bool cIssueFilter::HasRegion() const
+{
+    return m_HasRegion;
+}
+
+bool cIssueFilter::HasComparison() const
+{
+    return m_HasComparison;
+}
+
+cIssueFilter::eComparison cIssueFilter::GetComparison(std::size_t index) const
+{
+    if (!m_HasComparison || index >= m_Issues.size())
+        return UNCHANGED_ISSUE;
+
+    if (GetBit(m_NewBits, index))
+        return NEW_ISSUE;
+
+    return GetBit(m_FixedBits, index) ? FIXED_ISSUE : UNCHANGED_ISSUE;
+}
+
+std::size_t cIssueFilter::GetComparisonCount(eComparison comparison) const
+{
+    return m_ComparisonCounts[comparison];
+}
+
+const std::vector<cIssue *> &cIssueFilter::GetIssues() const
+{
+    return m_Issues;
+}
+
+std::vector<cIssue *> cIssueFilter::GetContainerIssues() const
+{
+    if (!m_HasComparison)
+        return m_Issues;
+
+    std::vector<cIssue *> issues;
+    issues.reserve(m_Issues.size() - m_ComparisonCounts[FIXED_ISSUE]);
+    for (std::size_t i = 0; i < m_Issues.size(); ++i)
+    {
+        if (!GetBit(m_FixedBits, i))
+            issues.push_back(m_Issues[i]);
+    }
+    return issues;
+}
+
+std::size_t cIssueFilter::GetIssueCount() const
+{
+    return m_Issues.size();
+}
+
+cIssue *cIssueFilter::GetIssue(std::size_t index) const
+{
+    return (index < m_Issues.size()) ? m_Issues[index] : nullptr;
+}
+
+bool cIssueFilter::IsVisible(std::size_t index) const
+{
+    if (index >= m_Issues.size())
+        return false;
+
+    return GetBit(m_VisibleBits, index);
+}
+
+cIssueFilter::tRange cIssueFilter::GetRange() const
+{
+    return tRange(0, m_Issues.size());
+}
+
+cIssueFilter::tRange cIssueFilter::GetRange(const cCheckerBundle *bundle) const
+{
+    auto it = m_BundleRanges.find(bundle);
+    return (it != m_BundleRanges.end()) ? it->second : tRange(0, 0);
+}
+
+cIssueFilter::tRange cIssueFilter::GetRange(const cChecker *checker) const
+{
+    auto it = m_CheckerRanges.find(checker);
+    return (it != m_CheckerRanges.end()) ? it->second : tRange(0, 0);
+}
+
+std::size_t cIssueFilter::CountVisible(const tRange &range) const
+{
+    const std::size_t end = std::min(range.second, m_Issues.size());
+    std::size_t count = 0;
+    std::size_t i = range.first;
+
+    // Single bits up to the next word boundary, then whole words
+    for (; i < end && i % BITS_PER_WORD != 0; ++i)
+        count += IsVisible(i) ? 1 : 0;
+
+    for (; i + BITS_PER_WORD <= end; i += BITS_PER_WORD)
+        count += std::bitset<BITS_PER_WORD>(m_VisibleBits[i / BITS_PER_WORD]).count();
+
+    for (; i < end; ++i)
+        count += IsVisible(i) ? 1 : 0;
+
+    return count;
+}
+
+void cIssueFilter::ApplyToIssues() const
+{
+    for (std::size_t i = 0; i < m_Issues.size(); ++i)
+    {
+        if (!m_HasComparison || !GetBit(m_FixedBits, i))
+            m_Issues[i]->SetEnabled(IsVisible(i));
+    }
+}
+
+void cIssueFilter::RestoreIssues() const
+{
+    for (std::size_t i = 0; i < m_Issues.size(); ++i)
+    {
+        if (!m_HasComparison || !GetBit(m_FixedBits, i))
+            m_Issues[i]->SetEnabled(GetBit(m_EnabledBits, i));
+    }
+}
+
+void cIssueFilter::UpdateVisibleBits()
+{
+    const uint64_t infoMask = (m_State & SHOW_INFO_LEVEL) ? ~0ULL : 0;
+    const uint64_t warningMask = (m_State & SHOW_WARNING_LEVEL) ? ~0ULL : 0;
+    const uint64_t errorMask = (m_State & SHOW_ERROR_LEVEL) ? ~0ULL : 0;
+    const uint64_t repetitiveMask = (m_State & SHOW_REPETITIVE_ISSUES) ? ~0ULL : 0;
+    const uint64_t newMask = (m_State & SHOW_NEW_ISSUES) ? ~0ULL : 0;
+    const uint64_t fixedMask = (m_State & SHOW_FIXED_ISSUES) ? ~0ULL : 0;
+    const uint64_t unchangedMask = (m_State & SHOW_UNCHANGED_ISSUES) ? ~0ULL : 0;
+
+    for (std::size_t w = 0; w < m_VisibleBits.size(); ++w)
+    {
+        const uint64_t levels =
+            (m_InfoBits[w] & infoMask) | (m_WarningBits[w] & warningMask) | (m_ErrorBits[w] & errorMask);
+        const uint64_t matches = m_HasMatches ? m_MatchBits[w] : ~0ULL;
+        const uint64_t region = m_HasRegion ? m_RegionBits[w] : ~0ULL;
+
+        // Without comparison all issues pass
+        uint64_t comparison = ~0ULL;
+        if (m_HasComparison)
+        {
+            const uint64_t unchanged = ~(m_NewBits[w] | m_FixedBits[w]);
+            comparison = (m_NewBits[w] & newMask) | (m_FixedBits[w] & fixedMask) | (unchanged & unchangedMask);
+        }
+
+        m_VisibleBits[w] =
+            levels & (m_FirstOfRuleBits[w] | repetitiveMask) & m_EnabledBits[w] & comparison & matches & region;
+    }
+}
+
+void cIssueFilter::SetBit(tBitset &bitset, std::size_t index)
+{
+    bitset[index / BITS_PER_WORD] |= 1ULL << (index % BITS_PER_WORD);
+}
+
+bool cIssueFilter::GetBit(const tBitset &bitset, std::size_t index)
+{
+    return (bitset[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+}
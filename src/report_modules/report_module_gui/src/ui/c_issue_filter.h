@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef ISSUE_FILTER_H
+#define ISSUE_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class cIssue;
+class cChecker;
+class cCheckerBundle;
+class cResultContainer;
+class cResultDiff;
+
+/*
+ * Visibility of the issues of a result container for the level and repetitive issue filters of the GUI.
+ *
+ * All issues are kept in one list in the order of the container, so the issues of a checker and of a checker bundle
+ * form a contiguous range. The level of every issue and whether it is the first issue of its rule UID are stored
+ * as bitsets, which are collected once when the container is loaded. Changing the filter state combines these
+ * bitsets word by word and does not access the issues. The visible issues can additionally be restricted to a set of
+ * matches, e.g. the result of a search, and to a region, e.g. the issues of a part of the input file.
+ *
+ * If the container is compared with reference results, every issue is new or unchanged. The issues of the reference
+ * which are not in the container are fixed. They are added after the issues of the checker with the same checker
+ * bundle name and checker ID, or at the end of the checker bundle or of the list if there is no such checker.
+ */
+class cIssueFilter
+{
+  public:
+    // Bits of the filter state
+    static const int SHOW_REPETITIVE_ISSUES = 1;
+    static const int SHOW_INFO_LEVEL = 2;
+    static const int SHOW_WARNING_LEVEL = 4;
+    static const int SHOW_ERROR_LEVEL = 8;
+    static const int SHOW_NEW_ISSUES = 16;
+    static const int SHOW_FIXED_ISSUES = 32;
+    static const int SHOW_UNCHANGED_ISSUES = 64;
+    static const int SHOW_ALL = SHOW_REPETITIVE_ISSUES | SHOW_INFO_LEVEL | SHOW_WARNING_LEVEL | SHOW_ERROR_LEVEL |
+                                SHOW_NEW_ISSUES | SHOW_FIXED_ISSUES | SHOW_UNCHANGED_ISSUES;
+
+    // Class of an issue in a comparison with reference results
+    enum eComparison
+    {
+        UNCHANGED_ISSUE,
+        NEW_ISSUE,
+        FIXED_ISSUE
+    };
+
+    // Range of issue indices [first, second)
+    typedef std::pair<std::size_t, std::size_t> tRange;
+
+    // One bit per issue index
+    typedef std::vector<uint64_t> tBitset;
+
+    /*
+     * Collects the issues of a container and their bitsets. Issues which are disabled in the container stay hidden.
+     * The filter state is reset to SHOW_ALL and the matches and the region are removed.
+     * \param container: Results to filter
+     * \param comparison: Comparison of reference results with the container, or nullptr. The fixed issues refer to
+     *                    the reference results, which have to stay valid as long as the filter is used.
+     */
+    void Build(cResultContainer *const container, const cResultDiff *comparison = nullptr);
+
+    // Sets the filter state, a combination of the SHOW_ bits
+    void SetState(int state);
+
+    // Returns the filter state
+    int GetState() const;
+
+    // Shows only the issues whose bit is set in the matches, in addition to the filter state
+    void SetMatches(tBitset matches);
+
+    // Removes the restriction to matches
+    void ClearMatches();
+
+    // Returns true if the visible issues are restricted to matches
+    bool HasMatches() const;
+
+    // Shows only the issues whose bit is set in the region, in addition to the filter state and the matches
+    void SetRegion(tBitset region);
+
+    // Removes the restriction to a region
+    void ClearRegion();
+
+    // Returns true if the visible issues are restricted to a region
+    bool HasRegion() const;
+
+    // Returns true if the filter was built with a comparison
+    bool HasComparison() const;
+
+    // Returns the class of the issue with the given index in the comparison, UNCHANGED_ISSUE without comparison
+    eComparison GetComparison(std::size_t index) const;
+
+    // Returns the number of issues of a class in the comparison
+    std::size_t GetComparisonCount(eComparison comparison) const;
+
+    // Returns all issues in the order of the container
+    const std::vector<cIssue *> &GetIssues() const;
+
+    // Returns the issues of the container without the fixed issues, which belong to the reference results
+    std::vector<cIssue *> GetContainerIssues() const;
+
+    // Returns the number of issues of the container
+    std::size_t GetIssueCount() const;
+
+    // Returns the issue with the given index
+    cIssue *GetIssue(std::size_t index) const;
+
+    // Returns true if the issue with the given index passes the filter
+    bool IsVisible(std::size_t index) const;
+
+    // Returns the range of all issues
+    tRange GetRange() const;
+
+    // Returns the range of the issues of a checker bundle
+    tRange GetRange(const cCheckerBundle *bundle) const;
+
+    // Returns the range of the issues of a checker
+    tRange GetRange(const cChecker *checker) const;
+
+    // Returns the number of issues of a range which pass the filter
+    std::size_t CountVisible(const tRange &range) const;
+
+    /*
+     * Enables the issues of the container which pass the filter and disables all others, e.g. before the results are
+     * written. The fixed issues of the reference results are not changed. RestoreIssues() undoes the changes.
+     */
+    void ApplyToIssues() const;
+
+    // Restores the enabled state the issues of the container had when the filter was built
+    void RestoreIssues() const;
+
+  private:
+    static const std::size_t BITS_PER_WORD = 64;
+
+    static void SetBit(tBitset &bitset, std::size_t index);
+
+    static bool GetBit(const tBitset &bitset, std::size_t index);
+
+    // Combines the bitsets according to the state, the comparison, the matches and the region
+    void UpdateVisibleBits();
+
+    std::vector<cIssue *> m_Issues;
+
+    tBitset m_InfoBits;
+    tBitset m_WarningBits;
+    tBitset m_ErrorBits;
+    tBitset m_FirstOfRuleBits;
+    tBitset m_EnabledBits;
+
+    tBitset m_NewBits;
+    tBitset m_FixedBits;
+    bool m_HasComparison{false};
+    std::size_t m_ComparisonCounts[3]{0, 0, 0};
+
+    tBitset m_MatchBits;
+    bool m_HasMatches{false};
+
+    tBitset m_RegionBits;
+    bool m_HasRegion{false};
+
+    // Result of the combination of the state, the comparison, the matches and the region
+    tBitset m_VisibleBits;
+    int m_State{SHOW_ALL};
+
+    std::unordered_map<const cCheckerBundle *, tRange> m_BundleRanges;
+    std::unordered_map<const cChecker *, tRange> m_CheckerRanges;
+};
+
+#endif
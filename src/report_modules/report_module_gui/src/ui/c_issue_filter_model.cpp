@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_issue_filter_model.h"
+
+#include "c_issue_tree_model.h"
+
+cIssueFilterModel::cIssueFilterModel(cIssueTreeModel *issueModel, QObject *parent)
+    : QSortFilterProxyModel(parent), m_IssueModel(issueModel)
+{
+    setSourceModel(issueModel);
+}
+
+void cIssueFilterModel::UpdateFilter()
+{
+    invalidateFilter();
+}
+
+bool cIssueFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    if (sourceParent.isValid() || m_IssueModel->GetIssueCount() == 0)
+        return true;
+
+    return m_IssueModel->IsIssueVisible(sourceRow);
+}
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef ISSUE_FILTER_MODEL_H
+#define ISSUE_FILTER_MODEL_H
+
+#include <QtCore/QSortFilterProxyModel>
+
+class cIssueTreeModel;
+
+/*
+ * Proxy model which hides the issue rows of a cIssueTreeModel that do not pass its issue filter. Accepting a row is
+ * a lookup in the visibility bitset of the filter. Locations and the placeholder row are always accepted.
+ */
+class cIssueFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+  public:
+    cIssueFilterModel(cIssueTreeModel *issueModel, QObject *parent = nullptr);
+
+    // Applies a changed state of the issue filter to the shown rows
+    void UpdateFilter();
+
+  protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+
+  private:
+    cIssueTreeModel *m_IssueModel;
+};
+
+#endif
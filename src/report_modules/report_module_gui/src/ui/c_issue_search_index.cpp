@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_issue_search_index.h"
+
+#include "common/result_format/c_checker.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_locations_container.h"
+#include "common/result_format/c_xml_location.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+static bool IsTokenCharacter(unsigned char c)
+{
+    // Bytes of multi-byte UTF-8 sequences belong to the token
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c >= 0x80;
+}
+
+void cIssueSearchIndex::Build(const std::vector<cIssue *> &issues, const std::atomic<bool> &cancelled)
+{
+    std::unordered_map<std::string, std::vector<uint32_t>> postings;
+
+    m_IssueCount = issues.size();
+    m_Tokens.clear();
+    m_Postings.clear();
+
+    for (std::size_t i = 0; i < issues.size() && !cancelled; ++i)
+    {
+        const cIssue *issue = issues[i];
+        const uint32_t issueIndex = (uint32_t)i;
+
+        std::vector<std::string> texts = {issue->GetDescription(), issue->GetRuleUID()};
+
+        if (nullptr != issue->GetChecker())
+            texts.push_back(issue->GetChecker()->GetCheckerID());
+
+        for (const auto location : issue->GetLocationsContainer())
+        {
+            for (auto extendedInformation : location->GetExtendedInformations())
+            {
+                if (extendedInformation->IsType<cXMLLocation *>())
+                    texts.push_back(((cXMLLocation *)extendedInformation)->GetXPath());
+            }
+        }
+
+        for (const std::string &text : texts)
+        {
+            for (std::string &token : Tokenize(text))
+            {
+                // The issues are added in ascending order, so the postings stay sorted
+                std::vector<uint32_t> &issueIndices = postings[token];
+                if (issueIndices.empty() || issueIndices.back() != issueIndex)
+                    issueIndices.push_back(issueIndex);
+            }
+        }
+    }
+
+    m_Tokens.reserve(postings.size());
+    for (const auto &posting : postings)
+        m_Tokens.push_back(posting.first);
+    std::sort(m_Tokens.begin(), m_Tokens.end());
+
+    m_Postings.reserve(m_Tokens.size());
+    for (const std::string &token : m_Tokens)
+        m_Postings.push_back(std::move(postings[token]));
+}
+
+bool cIssueSearchIndex::Search(const std::string &query, cIssueFilter::tBitset &matches) const
+{
+    const std::vector<std::string> terms = Tokenize(query);
+    if (terms.empty())
+        return false;
+
+    const std::size_t wordCount = (m_IssueCount + 63) / 64;
+    cIssueFilter::tBitset termMatches(wordCount);
+
+    for (std::size_t t = 0; t < terms.size(); ++t)
+    {
+        const std::string &term = terms[t];
+        std::fill(termMatches.begin(), termMatches.end(), 0);
+
+        // All tokens with the term as prefix follow the first token which is not less than the term
+        auto it = std::lower_bound(m_Tokens.begin(), m_Tokens.end(), term);
+        for (; it != m_Tokens.end() && it->compare(0, term.size(), term) == 0; ++it)
+        {
+            for (uint32_t issueIndex : m_Postings[it - m_Tokens.begin()])
+                termMatches[issueIndex / 64] |= 1ULL << (issueIndex % 64);
+        }
+
+        if (t == 0)
+            matches = termMatches;
+        else
+        {
+            for (std::size_t w = 0; w < wordCount; ++w)
+                matches[w] &= termMatches[w];
+        }
+    }
+
+    return true;
+}
+
+std::size_t cIssueSearchIndex::GetTokenCount() const
+{
+    return m_Tokens.size();
+}
+
+std::vector<std::string> cIssueSearchIndex::Tokenize(const std::string &text)
+{
+    std::vector<std::string> tokens;
+    std::string token;
+
+    for (unsigned char c : text)
+    {
+        if (IsTokenCharacter(c))
+            token += (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : (char)c;
+        else if (!token.empty())
+        {
+            tokens.push_back(token);
+            token.clear();
+        }
+    }
+
+    if (!token.empty())
+        tokens.push_back(token);
+
+    return tokens;
+}
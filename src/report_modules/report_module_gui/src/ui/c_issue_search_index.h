@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef ISSUE_SEARCH_INDEX_H
+#define ISSUE_SEARCH_INDEX_H
+
+#include "c_issue_filter.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+class cIssue;
+
+/*
+ * Inverted index for the full-text search over issues. The texts of an issue are its description, its rule UID, the
+ * ID of its checker and the XPaths of its locations. They are split into tokens, which are runs of letters and digits
+ * compared case-insensitively. Every token maps to the sorted indices of the issues that contain it.
+ *
+ * A query is split into tokens the same way. Every query token matches all tokens it is a prefix of, and an issue
+ * matches the query if it matches all query tokens.
+ */
+class cIssueSearchIndex
+{
+  public:
+    /*
+     * Builds the index. The indices of the issues in the list are the indices reported by Search().
+     * \param issues: Issues to index
+     * \param cancelled: Building stops early if it is set
+     */
+    void Build(const std::vector<cIssue *> &issues, const std::atomic<bool> &cancelled);
+
+    /*
+     * Searches the issues.
+     * \param query: Text to search for
+     * \param matches: Receives one bit per issue, which is set if the issue matches
+     * \return False if the query contains no tokens
+     */
+    bool Search(const std::string &query, cIssueFilter::tBitset &matches) const;
+
+    // Returns the number of different tokens
+    std::size_t GetTokenCount() const;
+
+    // Splits a text into lower case tokens
+    static std::vector<std::string> Tokenize(const std::string &text);
+
+  private:
+    std::size_t m_IssueCount{0};
+
+    // Sorted tokens and the sorted issue indices of every token
+    std::vector<std::string> m_Tokens;
+    std::vector<std::vector<uint32_t>> m_Postings;
+};
+
+#endif
@@ -0,0 +1,439 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_issue_tree_model.h"
+
+#include <QtCore/QSize>
+#include <QtGui/QBrush>
+
+#include "c_checker_widget.h"
+
+#include "common/result_format/c_file_location.h"
+#include "common/result_format/c_inertial_location.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_locations_container.h"
+#include "common/result_format/c_message_location.h"
+#include "common/result_format/c_time_location.h"
+#include "common/result_format/c_xml_location.h"
+
+#include <iomanip>
+
+// Internal id of issue rows. Location rows store the row of their issue + 1.
+static const quintptr ISSUE_ROW_ID = 0;
+
+cIssueTreeModel::cIssueTreeModel(QObject *parent)
+    : QAbstractItemModel(parent), m_IconMarkedVisible(":/icons/marked_visible.png"),
+      m_IconMarked(":/icons/marked.png"), m_IconVisible(":/icons/visible.png"), m_IconIssue(":/icons/issue.png"),
+      m_IconInfo(":/icons/green.png"), m_IconWarning(":/icons/yellow.png"), m_IconError(":/icons/red.png")
+{
+}
+
+void cIssueTreeModel::SetIssues(const cIssueFilter *filter, const cIssueFilter::tRange &range)
+{
+    beginResetModel();
+
+    m_Filter = filter;
+    m_FirstIssue = range.first;
+    m_IssueCount = (range.second > range.first) ? (int)(range.second - range.first) : 0;
+    m_Locations.clear();
+    m_LocationTexts.clear();
+
+    endResetModel();
+}
+
+void cIssueTreeModel::Clear()
+{
+    beginResetModel();
+
+    m_Filter = nullptr;
+    m_FirstIssue = 0;
+    m_IssueCount = 0;
+    m_Locations.clear();
+    m_LocationTexts.clear();
+
+    endResetModel();
+}
+
+int cIssueTreeModel::GetIssueCount() const
+{
+    return m_IssueCount;
+}
+
+bool cIssueTreeModel::IsIssueVisible(int row) const
+{
+    if (row < 0 || row >= m_IssueCount)
+        return false;
+
+    return m_Filter->IsVisible(m_FirstIssue + row);
+}
+
+cIssue *cIssueTreeModel::GetIssue(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return nullptr;
+
+    return GetIssueOfRow((index.internalId() == ISSUE_ROW_ID) ? index.row() : (int)index.internalId() - 1);
+}
+
+cIssue *cIssueTreeModel::GetIssueOfRow(int row) const
+{
+    if (row < 0 || row >= m_IssueCount)
+        return nullptr;
+
+    return m_Filter->GetIssue(m_FirstIssue + row);
+}
+
+cLocationsContainer *cIssueTreeModel::GetLocation(const QModelIndex &index) const
+{
+    if (!IsLocation(index))
+        return nullptr;
+
+    const std::vector<cLocationsContainer *> &locations = GetLocations((int)index.internalId() - 1);
+    if (index.row() >= (int)locations.size())
+        return nullptr;
+
+    return locations[index.row()];
+}
+
+bool cIssueTreeModel::IsLocation(const QModelIndex &index) const
+{
+    return index.isValid() && index.internalId() != ISSUE_ROW_ID;
+}
+
+QModelIndex cIssueTreeModel::IndexOf(const cIssue *issue) const
+{
+    for (int row = 0; row < m_IssueCount; ++row)
+    {
+        if (GetIssueOfRow(row) == issue)
+            return createIndex(row, 0, ISSUE_ROW_ID);
+    }
+
+    return QModelIndex();
+}
+
+QModelIndex cIssueTreeModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (!hasIndex(row, column, parent))
+        return QModelIndex();
+
+    if (!parent.isValid())
+        return createIndex(row, column, ISSUE_ROW_ID);
+
+    return createIndex(row, column, (quintptr)parent.row() + 1);
+}
+
+QModelIndex cIssueTreeModel::parent(const QModelIndex &index) const
+{
+    if (!IsLocation(index))
+        return QModelIndex();
+
+    return createIndex((int)index.internalId() - 1, 0, ISSUE_ROW_ID);
+}
+
+int cIssueTreeModel::rowCount(const QModelIndex &parent) const
+{
+    if (!parent.isValid())
+        return (m_IssueCount == 0) ? 1 : m_IssueCount;
+
+    // Locations have no children
+    if (IsLocation(parent) || parent.column() != 0)
+        return 0;
+
+    cIssue *issue = GetIssue(parent);
+    if (nullptr == issue)
+        return 0;
+
+    return (int)issue->GetLocationsCount();
+}
+
+int cIssueTreeModel::columnCount(const QModelIndex &) const
+{
+    return COLUMN_COUNT;
+}
+
+bool cIssueTreeModel::hasChildren(const QModelIndex &parent) const
+{
+    return rowCount(parent) > 0;
+}
+
+QVariant cIssueTreeModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid())
+        return QVariant();
+
+    if (m_IssueCount == 0)
+        return PlaceholderData(index.column(), role);
+
+    if (IsLocation(index))
+        return LocationData((int)index.internalId() - 1, index.row(), index.column(), role);
+
+    cIssue *issue = GetIssue(index);
+    if (nullptr == issue)
+        return QVariant();
+
+    return IssueData(issue, m_Filter->GetComparison(m_FirstIssue + index.row()), index.column(), role);
+}
+
+QVariant cIssueTreeModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+        return QVariant();
+
+    switch (section)
+    {
+    case 0:
+        return QString("ID");
+    case 2:
+        return QString("Level");
+    case 3:
+        return QString("Description");
+    default:
+        return QVariant();
+    }
+}
+
+Qt::ItemFlags cIssueTreeModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return Qt::NoItemFlags;
+
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+QVariant cIssueTreeModel::IssueData(cIssue *issue, cIssueFilter::eComparison comparison, int column, int role) const
+{
+    if (column == 0)
+    {
+        if (role == Qt::DisplayRole)
+            return QString::number(issue->GetIssueId());
+        if (role == Qt::ToolTipRole)
+            return QString("Identifier");
+    }
+    else if (column == 1)
+    {
+        if (role == (int)cCheckerWidget::ISSUE_DATA)
+            return QVariant((qulonglong)issue->GetIssueId());
+        if (role == (int)cCheckerWidget::ISSUE_EXTENDED_DATA)
+            return false;
+        if (role != Qt::DecorationRole && role != Qt::ToolTipRole && role != Qt::SizeHintRole)
+            return QVariant();
+
+        if (!issue->HasLocations())
+        {
+            if (role == Qt::DecorationRole)
+                return m_IconIssue;
+            if (role == Qt::ToolTipRole)
+                return QString("Issue is not marked in XML view and not visible in XODR viewer");
+            return QSize(35, 30);
+        }
+
+        bool isVisibleInViewer = false;
+        bool isVisibleInFileView = false;
+
+        for (const auto subIssue : issue->GetLocationsContainer())
+        {
+            if (subIssue->HasExtendedInformation<cInertialLocation *>())
+                isVisibleInViewer = true;
+
+            if (subIssue->HasExtendedInformation<cFileLocation *>())
+                isVisibleInFileView = true;
+        }
+
+        if (isVisibleInFileView)
+        {
+            if (role == Qt::DecorationRole)
+                return isVisibleInViewer ? m_IconMarkedVisible : m_IconMarked;
+            if (role == Qt::ToolTipRole)
+                return isVisibleInViewer ? QString("Issue is marked in XML view and visible in XODR viewer")
+                                         : QString("Issue is marked in XML view");
+            return QSize(35, 30);
+        }
+
+        if (isVisibleInViewer)
+        {
+            if (role == Qt::DecorationRole)
+                return m_IconVisible;
+            if (role == Qt::ToolTipRole)
+                return QString("Issue is visible in XODR viewer");
+            return QSize(35, 30);
+        }
+    }
+    else if (column == 2)
+    {
+        if (role == Qt::SizeHintRole)
+            return QSize(35, 30);
+
+        if (role == Qt::DecorationRole)
+        {
+            if (issue->GetIssueLevel() == INFO_LVL)
+                return m_IconInfo;
+            if (issue->GetIssueLevel() == WARNING_LVL)
+                return m_IconWarning;
+            return m_IconError;
+        }
+
+        if (role == Qt::ToolTipRole)
+        {
+            if (issue->GetIssueLevel() == INFO_LVL)
+                return QString("Information");
+            if (issue->GetIssueLevel() == WARNING_LVL)
+                return QString("Warning");
+            return QString("Error");
+        }
+    }
+    else if (column == 3)
+    {
+        // Issues which differ from the reference results are marked
+        if (role == Qt::DisplayRole || role == Qt::ToolTipRole)
+        {
+            if (comparison == cIssueFilter::NEW_ISSUE)
+                return QString("[New] ") + QString(issue->GetDescription().c_str());
+            if (comparison == cIssueFilter::FIXED_ISSUE)
+                return QString("[Fixed] ") + QString(issue->GetDescription().c_str());
+            return QString(issue->GetDescription().c_str());
+        }
+
+        if (role == Qt::BackgroundRole)
+        {
+            if (comparison == cIssueFilter::NEW_ISSUE)
+                return QBrush(QColor(255, 220, 220));
+            if (comparison == cIssueFilter::FIXED_ISSUE)
+                return QBrush(QColor(220, 245, 220));
+        }
+    }
+
+    return QVariant();
+}
+
+QVariant cIssueTreeModel::LocationData(int issueRow, int locationRow, int column, int role) const
+{
+    const std::vector<cLocationsContainer *> &locations = GetLocations(issueRow);
+    cIssue *issue = GetIssueOfRow(issueRow);
+    if (nullptr == issue || locationRow >= (int)locations.size())
+        return QVariant();
+
+    cLocationsContainer *location = locations[locationRow];
+
+    if (column == 1)
+    {
+        if (role == (int)cCheckerWidget::ISSUE_DATA)
+            return QVariant((qulonglong)issue->GetIssueId());
+        if (role == (int)cCheckerWidget::ISSUE_EXTENDED_DATA)
+            return true;
+        if (role == (int)cCheckerWidget::ISSUE_EXTENDED_DESCRIPTION)
+            return QString(location->GetDescription().c_str());
+        if (role == (int)cCheckerWidget::ISSUE_ORDER)
+            return locationRow;
+    }
+    else if (column == 3 && role == Qt::DisplayRole)
+        return GetLocationText(location);
+
+    return QVariant();
+}
+
+QVariant cIssueTreeModel::PlaceholderData(int column, int role) const
+{
+    if (role == Qt::ToolTipRole && column == 0)
+        return QString("Identifier");
+
+    if (role == Qt::DisplayRole)
+        return (column == 3) ? QString("No Issues Found") : QString("-");
+
+    return QVariant();
+}
+
+const std::vector<cLocationsContainer *> &cIssueTreeModel::GetLocations(int issueRow) const
+{
+    auto it = m_Locations.find(issueRow);
+    if (it != m_Locations.end())
+        return it->second;
+
+    std::vector<cLocationsContainer *> &locations = m_Locations[issueRow];
+    cIssue *issue = GetIssueOfRow(issueRow);
+    if (nullptr != issue)
+    {
+        const std::list<cLocationsContainer *> issueLocations = issue->GetLocationsContainer();
+        locations.assign(issueLocations.begin(), issueLocations.end());
+    }
+
+    return locations;
+}
+
+const QString &cIssueTreeModel::GetLocationText(const cLocationsContainer *location) const
+{
+    auto it = m_LocationTexts.find(location);
+    if (it != m_LocationTexts.end())
+        return it->second;
+
+    std::stringstream ssDesc;
+    ssDesc << location->GetDescription();
+
+    if (location->HasExtendedInformations())
+    {
+        for (auto xItem : location->GetExtendedInformations())
+        {
+            PrintExtendedInformationIntoStream(xItem, &ssDesc);
+        }
+    }
+
+    return m_LocationTexts[location] = QString(ssDesc.str().c_str());
+}
+
+void cIssueTreeModel::PrintExtendedInformationIntoStream(cExtendedInformation *item, std::stringstream *ssStream)
+{
+    if (item->IsType<cFileLocation *>())
+    {
+        cFileLocation *fileLoc = (cFileLocation *)item;
+        *ssStream << std::endl << "   File:";
+        if (fileLoc->HasRowColumn())
+            *ssStream << " row=" << fileLoc->GetRow() << " column=" << fileLoc->GetColumn();
+        if (fileLoc->HasOffset())
+            *ssStream << " offset=" << fileLoc->GetOffset();
+    }
+    else if (item->IsType<cXMLLocation *>())
+    {
+        cXMLLocation *xmlLoc = (cXMLLocation *)item;
+        *ssStream << std::endl << "   XPath: " << xmlLoc->GetXPath();
+    }
+    else if (item->IsType<cInertialLocation *>())
+    {
+        cInertialLocation *initialLoc = (cInertialLocation *)item;
+
+        ssStream->setf(std::ios::fixed, std::ios::floatfield);
+        *ssStream << std::endl
+                  << "   Inertial Location: x=" << std::setprecision(2) << initialLoc->GetX()
+                  << " y=" << std::setprecision(2) << initialLoc->GetY() << " z=" << std::setprecision(2)
+                  << initialLoc->GetZ();
+    }
+    else if (item->IsType<cTimeLocation *>())
+    {
+        cTimeLocation *timeLoc = (cTimeLocation *)item;
+        *ssStream << std::endl << "   Time Location: " << timeLoc->GetTime();
+    }
+    else if (item->IsType<cMessageLocation *>())
+    {
+        cMessageLocation *messageLoc = (cMessageLocation *)item;
+        *ssStream << std::endl << "   Message Location: index=" << messageLoc->GetIndex();
+        if (messageLoc->GetChannel())
+        {
+            *ssStream << " channel=" << *messageLoc->GetChannel();
+        }
+        if (messageLoc->GetField())
+        {
+            *ssStream << " field=" << *messageLoc->GetField();
+        }
+        if (messageLoc->GetTime())
+        {
+            *ssStream << " time=" << *messageLoc->GetTime();
+        }
+    }
+    else
+    {
+        *ssStream << std::endl << "   Unknown extended information type";
+    }
+}
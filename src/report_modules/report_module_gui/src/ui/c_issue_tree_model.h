@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef ISSUE_TREE_MODEL_H
+#define ISSUE_TREE_MODEL_H
+
+#include <QtCore/QAbstractItemModel>
+#include <QtGui/QIcon>
+
+#include "c_issue_filter.h"
+
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+class cIssue;
+class cExtendedInformation;
+class cLocationsContainer;
+
+/*
+ * Item model for the issue view. The top level rows are the issues, their children are the locations of an issue.
+ *
+ * The model shows a range of the issues of an issue filter and does not copy them. The texts and icons of a row are
+ * created when the view requests them, so only the visible rows are materialized. The locations of an issue are
+ * collected the first time the children of its row are requested. The model contains all issues of the range;
+ * hiding the issues which do not pass the filter is left to a cIssueFilterModel.
+ *
+ * If no issues are set, the model contains a single placeholder row.
+ */
+class cIssueTreeModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+  public:
+    static const int COLUMN_COUNT = 4;
+
+    cIssueTreeModel(QObject *parent = nullptr);
+
+    // Replaces the shown issues by a range of the issues of a filter
+    void SetIssues(const cIssueFilter *filter, const cIssueFilter::tRange &range);
+
+    // Removes all issues.
+    void Clear();
+
+    // Returns the number of shown issues
+    int GetIssueCount() const;
+
+    // Returns true if the issue of a top level row passes the filter
+    bool IsIssueVisible(int row) const;
+
+    // Returns the issue of an index. For a location row the issue of the parent row is returned.
+    cIssue *GetIssue(const QModelIndex &index) const;
+
+    // Returns the location of a location row, nullptr for an issue row
+    cLocationsContainer *GetLocation(const QModelIndex &index) const;
+
+    // Returns true if the index is a location row
+    bool IsLocation(const QModelIndex &index) const;
+
+    // Returns the index of the first column of an issue, or an invalid index if the issue is not shown
+    QModelIndex IndexOf(const cIssue *issue) const;
+
+    // Prints extended informations into a stream
+    static void PrintExtendedInformationIntoStream(cExtendedInformation *item, std::stringstream *ssStream);
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex &index) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+  private:
+    // Data of an issue row
+    QVariant IssueData(cIssue *issue, cIssueFilter::eComparison comparison, int column, int role) const;
+
+    // Data of a location row
+    QVariant LocationData(int issueRow, int locationRow, int column, int role) const;
+
+    // Data of the placeholder row
+    QVariant PlaceholderData(int column, int role) const;
+
+    // Returns the locations of an issue row. They are collected on first access.
+    const std::vector<cLocationsContainer *> &GetLocations(int issueRow) const;
+
+    // Returns the text of a location row. It is formatted on first access, e.g. when the row is painted.
+    const QString &GetLocationText(const cLocationsContainer *location) const;
+
+    // Returns the issue of a top level row
+    cIssue *GetIssueOfRow(int row) const;
+
+    const cIssueFilter *m_Filter{nullptr};
+    std::size_t m_FirstIssue{0};
+    int m_IssueCount{0};
+
+    // Locations of the issue rows, which have been requested by the view
+    mutable std::unordered_map<int, std::vector<cLocationsContainer *>> m_Locations;
+
+    // Texts of the location rows, which have been painted
+    mutable std::unordered_map<const cLocationsContainer *, QString> m_LocationTexts;
+
+    QIcon m_IconMarkedVisible;
+    QIcon m_IconMarked;
+    QIcon m_IconVisible;
+    QIcon m_IconIssue;
+    QIcon m_IconInfo;
+    QIcon m_IconWarning;
+    QIcon m_IconError;
+};
+
+#endif
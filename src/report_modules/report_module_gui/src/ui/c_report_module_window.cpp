@@ -16,7 +16,13 @@
 #include "c_report_module_window.h"
 
 #include "c_checker_widget.h"
+#include "c_file_viewer.h"
+#include "c_issue_density_map.h"
+#include "c_result_loader.h"
+#include "c_viewer_issue_records.h"
+#include "c_viewer_worker.h"
 
+#include "common/c_logger.h"
 #include "common/result_format/c_checker_bundle.h"
 #include "common/result_format/c_locations_container.h"
 #include "common/result_format/c_result_container.h"
@@ -24,52 +30,40 @@
 #include <QHBoxLayout>
 #include <QMimeData>
 #include <QVBoxLayout>
-#include <QtWidgets/QApplication>
 #include <QtWidgets/QDesktopWidget>
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QMenuBar>
 #include <QtWidgets/QMessageBox>
+#include <QtWidgets/QProgressBar>
+#include <QtWidgets/QPushButton>
 #include <QtWidgets/QSplitter>
-#include <unordered_set>
+#include <QtWidgets/QStatusBar>
 
-void cReportModuleWindow::highlightRow(const cIssue *const issue, const int row)
+void cReportModuleWindow::highlightRows(const cIssue *const issue, const QList<int> &rows)
 {
+    if (_fileViewer == nullptr)
+        return;
 
-    if (highlighter)
-    {
-        highlighter->setLineToHighlight(row - 1);
-        textEditArea->update();
-        // Move cursor to the highlighted row and center it
-        QTextCursor cursor = textEditArea->textCursor();
-        cursor.movePosition(QTextCursor::Start);
-        cursor.movePosition(QTextCursor::Down, QTextCursor::MoveAnchor, row - 1);
-        textEditArea->setTextCursor(cursor);
-        textEditArea->centerCursor();
-    }
+    // Rows of file locations start with 1
+    std::vector<int> lines;
+    lines.reserve(rows.size());
+    for (int row : rows)
+        lines.push_back(row - 1);
+
+    _fileViewer->HighlightLines(lines);
 }
 
 void cReportModuleWindow::loadFileContent(cResultContainer *const container)
 {
-    QString fileToOpen;
-    textEditArea->setPlainText("");
-    if (container->HasInputFileName())
-    {
-        fileToOpen = container->GetInputFilePath().c_str();
-    }
-    else
-    {
+    _fileViewer->CloseFile();
+    if (!container->HasInputFileName())
         return;
-    }
 
-    QFile file(fileToOpen);
-    if (file.open(QIODevice::ReadOnly | QIODevice::Text))
-    {
-        QTextStream in(&file);
-        textEditArea->setPlainText(in.readAll());
-        file.close();
-    }
+    QString fileToOpen = container->GetInputFilePath().c_str();
+    if (!_fileViewer->OpenFile(fileToOpen))
+        LogWarning() << "Could not open input file '" << fileToOpen.toStdString() << "'";
 }
 
 cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, const std::string &reportModuleName,
@@ -78,19 +72,36 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
     _results = resultContainer;
     _reportModuleName = QString::fromStdString(reportModuleName);
 
+    // Viewer plugins are called on a worker thread
+    _viewerWorker = new cViewerWorker(this);
+    connect(_viewerWorker, &cViewerWorker::RequestFinished, this, &cReportModuleWindow::OnViewerRequestFinished);
+    _viewerWorker->start();
+
     QAction *openAct = new QAction(tr("&Open result file..."), this);
     openAct->setShortcuts(QKeySequence::Open);
     openAct->setStatusTip(tr("Open an existing file"));
     connect(openAct, &QAction::triggered, this, &cReportModuleWindow::OpenResultFile);
 
-    QAction *saveAct = new QAction(tr("&Save result file..."), this);
-    saveAct->setShortcuts(QKeySequence::Save);
-    saveAct->setStatusTip(tr("Save current result file"));
-    connect(saveAct, &QAction::triggered, this, &cReportModuleWindow::SaveResultFile);
+    _saveAct = new QAction(tr("&Save result file..."), this);
+    _saveAct->setShortcuts(QKeySequence::Save);
+    _saveAct->setStatusTip(tr("Save current result file"));
+    connect(_saveAct, &QAction::triggered, this, &cReportModuleWindow::SaveResultFile);
+
+    QAction *compareAct = new QAction(tr("&Compare with result file..."), this);
+    compareAct->setStatusTip(tr("Mark the issues which are new or fixed compared with a reference result file"));
+    connect(compareAct, &QAction::triggered, this, &cReportModuleWindow::CompareResultFile);
+
+    _closeComparisonAct = new QAction(tr("C&lose comparison"), this);
+    _closeComparisonAct->setStatusTip(tr("Show the results without comparison"));
+    _closeComparisonAct->setEnabled(false);
+    connect(_closeComparisonAct, &QAction::triggered, this, &cReportModuleWindow::CloseComparison);
 
     _fileMenu = menuBar()->addMenu(tr("&File"));
     _fileMenu->addAction(openAct);
-    _fileMenu->addAction(saveAct);
+    _fileMenu->addAction(_saveAct);
+    _fileMenu->addSeparator();
+    _fileMenu->addAction(compareAct);
+    _fileMenu->addAction(_closeComparisonAct);
 
     QSplitter *splitter = new QSplitter(Qt::Horizontal);
 
@@ -129,7 +140,29 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
     checkboxLayout->addWidget(warningCheckBox);
     checkboxLayout->addWidget(errorCheckBox);
 
+    // Classes of a comparison with reference results
+    _comparisonCheckboxWidget = new QWidget();
+    QHBoxLayout *comparisonCheckboxLayout = new QHBoxLayout(_comparisonCheckboxWidget);
+
+    _newIssuesCheckBox = new QCheckBox("New", this);
+    _fixedIssuesCheckBox = new QCheckBox("Fixed", this);
+    _unchangedIssuesCheckBox = new QCheckBox("Unchanged", this);
+
+    _newIssuesCheckBox->setChecked(true);
+    _fixedIssuesCheckBox->setChecked(true);
+    _unchangedIssuesCheckBox->setChecked(true);
+
+    connect(_newIssuesCheckBox, &QCheckBox::toggled, this, &cReportModuleWindow::onNewIssuesToggled);
+    connect(_fixedIssuesCheckBox, &QCheckBox::toggled, this, &cReportModuleWindow::onFixedIssuesToggled);
+    connect(_unchangedIssuesCheckBox, &QCheckBox::toggled, this, &cReportModuleWindow::onUnchangedIssuesToggled);
+
+    comparisonCheckboxLayout->addWidget(_newIssuesCheckBox);
+    comparisonCheckboxLayout->addWidget(_fixedIssuesCheckBox);
+    comparisonCheckboxLayout->addWidget(_unchangedIssuesCheckBox);
+    _comparisonCheckboxWidget->setVisible(false);
+
     leftLayout->addWidget(checkboxWidget);
+    leftLayout->addWidget(_comparisonCheckboxWidget);
     leftLayout->addWidget(_checkerWidget);
 
     splitter->addWidget(leftWidget);
@@ -140,21 +173,23 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
     xmlReportWidgetLabel->setText("Source");
     xmlReportWidgetLabel->setStyleSheet("font-weight: bold;");
 
-    textEditArea = new QPlainTextEdit(xmlReportWidget);
-    textEditArea->setReadOnly(true);
-    textEditArea->setWordWrapMode(QTextOption::NoWrap);
+    // The input file is memory mapped and only the visible lines are shown
+    _fileViewer = new cFileViewer(xmlReportWidget);
+    _fileViewer->setFont(codeFont);
 
-    QFontMetrics metrics(codeFont);
+    // Overview of the issues along the input file
+    _densityMap = new cIssueDensityMap(xmlReportWidget);
+    connect(_fileViewer, &cFileViewer::LineCountChanged, _densityMap, &cIssueDensityMap::SetLineCount);
+    connect(_densityMap, &cIssueDensityMap::SelectionChanged, this, &cReportModuleWindow::OnDensitySelectionChanged);
 
-    textEditArea->setFont(codeFont);
-    textEditArea->setTabStopWidth(2 * metrics.width(' '));
-    textEditArea->setLineWrapMode(QPlainTextEdit::LineWrapMode::NoWrap);
+    QHBoxLayout *fileViewerLayout = new QHBoxLayout;
+    fileViewerLayout->addWidget(_fileViewer);
+    fileViewerLayout->addWidget(_densityMap);
+    fileViewerLayout->setContentsMargins(0, 0, 0, 0);
+    fileViewerLayout->setSpacing(2);
 
     xmlReportWidgetLayout->addWidget(xmlReportWidgetLabel);
-    xmlReportWidgetLayout->addWidget(textEditArea);
-
-    // Create LineHighlighter
-    highlighter = new LineHighlighter(textEditArea->document());
+    xmlReportWidgetLayout->addLayout(fileViewerLayout);
 
     xmlReportWidgetLayout->setContentsMargins(3, 6, 3, 3);
     xmlReportWidget->setLayout(xmlReportWidgetLayout);
@@ -163,8 +198,21 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
     setCentralWidget(splitter);
     setWindowTitle(this->_reportModuleName);
 
+    // Progress of reading result files, only visible while a file is read
+    _loadProgressBar = new QProgressBar(this);
+    _loadProgressBar->setRange(0, 100);
+    _loadProgressBar->setMaximumWidth(200);
+    _loadProgressBar->setVisible(false);
+
+    _cancelLoadButton = new QPushButton(tr("Cancel"), this);
+    _cancelLoadButton->setVisible(false);
+    connect(_cancelLoadButton, &QPushButton::clicked, this, &cReportModuleWindow::CancelLoading);
+
+    statusBar()->addPermanentWidget(_loadProgressBar);
+    statusBar()->addPermanentWidget(_cancelLoadButton);
+
     connect(_checkerWidget, &cCheckerWidget::Load, this, &cReportModuleWindow::loadFileContent);
-    connect(_checkerWidget, &cCheckerWidget::ShowInputIssue, this, &cReportModuleWindow::highlightRow);
+    connect(_checkerWidget, &cCheckerWidget::ShowInputIssue, this, &cReportModuleWindow::highlightRows);
     connect(_checkerWidget, &cCheckerWidget::ShowIssueIn3DViewer, this, &cReportModuleWindow::ShowIssueInViewer);
 
     // Create Menu entries for all viewers in plugin
@@ -187,7 +235,7 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
     }
     else
     {
-        std::cout << "found " << viewer_list.size() << " viewer plugins" << std::endl;
+        LogInfo() << "found " << viewer_list.size() << " viewer plugins";
 
         // Load dll for every viewer in plugin folder and create menu entry
         for (int32_t i = 0; i < viewer_list.count(); i++)
@@ -268,6 +316,13 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
                 break;
             }
 
+            // resolve function address AddIssues here, it is optional
+#ifdef WIN32
+            viewerEntries[i]->AddIssues_f = (AddIssues_ptr)GetProcAddress(viewer_dll, "AddIssues");
+#else
+            viewerEntries[i]->AddIssues_f = (AddIssues_ptr)dlsym(viewer_dll, "AddIssues");
+#endif
+
             // resolve function address ShowIssue here
 #ifdef WIN32
             viewerEntries[i]->ShowIssue_f = (ShowIssue_ptr)GetProcAddress(viewer_dll, "ShowIssue");
@@ -345,6 +400,8 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
         }
     }
 
+    _issueFilter.Build(resultContainer);
+    _issueFilter.SetState(GetFilterState());
     LoadResultContainer(resultContainer);
 
     // Set the size of the application of the half size of desktop
@@ -354,20 +411,39 @@ cReportModuleWindow::cReportModuleWindow(cResultContainer *resultContainer, cons
     setAcceptDrops(true);
 }
 
+cReportModuleWindow::~cReportModuleWindow()
+{
+    // The requests refer to the viewer entries
+    _viewerWorker->Finish();
+}
+
 // Loads the result container
-void cReportModuleWindow::LoadResultContainer(cResultContainer *const container) const
+void cReportModuleWindow::LoadResultContainer(cResultContainer *const container)
 {
     QMap<QString, QString> fileReplacementMap;
     std::list<cCheckerBundle *> bundles = container->GetCheckerBundles();
-    textEditArea->setPlainText("");
+    _fileViewer->CloseFile();
     for (std::list<cCheckerBundle *>::const_iterator itBundle = bundles.cbegin(); itBundle != bundles.cend();
          itBundle++)
     {
         ValidateInputFile(*itBundle, &fileReplacementMap, "InputFile", "Input file");
     }
 
+    // Only the issues of the bundles which refer to the shown input file are counted in the density map
+    const std::string inputFilePath = container->GetInputFilePath();
+    std::vector<cIssueFilter::tRange> inputFileRanges;
+    if (!inputFilePath.empty())
+    {
+        for (cCheckerBundle *bundle : container->GetCheckerBundles())
+        {
+            if (bundle->GetInputFilePath() == inputFilePath)
+                inputFileRanges.push_back(_issueFilter.GetRange(bundle));
+        }
+    }
+    _densityMap->SetIssues(_issueFilter.GetIssues(), inputFileRanges);
+
     if (_checkerWidget != nullptr)
-        _checkerWidget->LoadResultContainer(container);
+        _checkerWidget->LoadResultContainer(container, &_issueFilter);
 }
 
 void cReportModuleWindow::ValidateInputFile(cCheckerBundle *const bundle, QMap<QString, QString> *fileReplacementMap,
@@ -413,8 +489,102 @@ void cReportModuleWindow::OpenResultFile()
     LoadResultFromFilepath(filePath);
 }
 
+void cReportModuleWindow::CompareResultFile()
+{
+    if (_results->GetCheckerBundles().size() == 0)
+    {
+        QMessageBox msgBox;
+        msgBox.setWindowTitle(this->_reportModuleName + " Error");
+        msgBox.setStandardButtons(QMessageBox::Ok);
+        msgBox.setText("Result file not loaded. Cannot compare it!");
+        msgBox.exec();
+        return;
+    }
+
+    QString filePath =
+        QFileDialog::getOpenFileName(this, tr("Open Reference File"), "", "XQAR checker results (*.xqar)");
+    if (filePath.isEmpty())
+        return;
+
+    // A reference which is still read is replaced by the new one
+    CancelComparison();
+
+    _compareLoader = new cResultLoader(filePath, this);
+    _compareLoader->SetComparedResults(_results);
+
+    connect(_compareLoader, &cResultLoader::Progress, this, &cReportModuleWindow::OnLoadProgress);
+    connect(_compareLoader, &QThread::finished, this, &cReportModuleWindow::OnComparisonLoaded);
+
+    _loadProgressBar->setValue(0);
+    UpdateProgressVisibility();
+    statusBar()->showMessage(tr("Comparing with %1 ...").arg(filePath));
+
+    _compareLoader->start();
+}
+
+void cReportModuleWindow::CloseComparison()
+{
+    CancelComparison();
+
+    if (!_issueFilter.HasComparison())
+        return;
+
+    _issueFilter.Build(_results);
+    _issueFilter.SetState(GetFilterState());
+    LoadResultContainer(_results);
+
+    // Queued viewer requests may refer to fixed issues, so the reference is freed after them
+    _viewerWorker->ReleaseAfterRequests(std::move(_referenceResults));
+    UpdateComparisonCheckboxes();
+    statusBar()->clearMessage();
+}
+
+void cReportModuleWindow::CancelComparison()
+{
+    // The loader reads _results, so it has to finish before they may change. The finished signal is still delivered
+    // and ignored.
+    if (_compareLoader != nullptr)
+    {
+        _compareLoader->Cancel();
+        _compareLoader->wait();
+        _compareLoader = nullptr;
+        UpdateProgressVisibility();
+    }
+}
+
+void cReportModuleWindow::UpdateProgressVisibility()
+{
+    const bool isLoading = _resultLoader != nullptr || _compareLoader != nullptr;
+    _loadProgressBar->setVisible(isLoading);
+    _cancelLoadButton->setVisible(isLoading);
+
+    // A comparison which is still running reads the enabled state of the issues, which saving changes
+    _saveAct->setEnabled(_compareLoader == nullptr);
+}
+
+void cReportModuleWindow::UpdateComparisonCheckboxes()
+{
+    const bool hasComparison = _issueFilter.HasComparison();
+    _comparisonCheckboxWidget->setVisible(hasComparison);
+    _closeComparisonAct->setEnabled(hasComparison);
+
+    if (!hasComparison)
+        return;
+
+    _newIssuesCheckBox->setText(
+        tr("New (%1)").arg((qulonglong)_issueFilter.GetComparisonCount(cIssueFilter::NEW_ISSUE)));
+    _fixedIssuesCheckBox->setText(
+        tr("Fixed (%1)").arg((qulonglong)_issueFilter.GetComparisonCount(cIssueFilter::FIXED_ISSUE)));
+    _unchangedIssuesCheckBox->setText(
+        tr("Unchanged (%1)").arg((qulonglong)_issueFilter.GetComparisonCount(cIssueFilter::UNCHANGED_ISSUE)));
+}
+
 void cReportModuleWindow::SaveResultFile()
 {
+    // Saving is disabled while a comparison runs, see UpdateProgressVisibility()
+    if (_compareLoader != nullptr)
+        return;
+
     if (_results->GetCheckerBundles().size() == 0)
     {
         QMessageBox msgBox;
@@ -431,7 +601,11 @@ void cReportModuleWindow::SaveResultFile()
         fileName.append(".xqar");
     }
 
+    // Only the issues which pass the filter are written. Afterwards the issues get their loaded state again, so the
+    // filter and later comparisons are not affected.
+    _issueFilter.ApplyToIssues();
     _results->WriteResults(fileName.toStdString());
+    _issueFilter.RestoreIssues();
 
     QMessageBox msgBox;
     msgBox.setWindowTitle(this->_reportModuleName + " Success");
@@ -445,72 +619,67 @@ void cReportModuleWindow::StartViewer(Viewer *viewer)
 {
     if (_viewerActive != nullptr)
     {
-        std::cout << "We have already an active viewer, closing it first... " << std::endl;
-        if (!_viewerActive->CloseViewer_f())
-        {
-            std::string error(_viewerActive->GetLastErrorMessage_f());
-            std::cout << "Closing the viewer " << _viewerActive->GetName_f() << " failed, error: " << error
-                      << std::endl;
-        }
+        LogInfo() << "We have already an active viewer, closing it first... ";
+
+        Viewer *activeViewer = _viewerActive;
+        _viewerWorker->Post(cViewerWorker::CLOSE_VIEWER, [activeViewer]() {
+            activeViewer->isStarted = false;
+            if (activeViewer->CloseViewer_f())
+                return QString();
+
+            return QString("Closing the viewer %1 failed, error: %2")
+                .arg(activeViewer->GetName_f(), activeViewer->GetLastErrorMessage_f());
+        });
 
         _viewerActive = nullptr;
     }
 
-    QMessageBox msgBox;
-    msgBox.setWindowTitle(this->_reportModuleName + " Error");
-    msgBox.setStandardButtons(QMessageBox::Ok);
-
     // Start viewer when we have an OpenDRIVE or an OpenSCENARIO
     if (_results != nullptr && _results->HasInputFileName())
     {
         setCursor(Qt::WaitCursor);
-        QApplication::processEvents();
 
-        // Start Viewer
-        bool result = viewer->StartViewer_f();
+        // The plugin is called on the worker thread, so the request gets its own copies of the path and the issues.
+        // Fixed issues are not passed, because the viewer may keep them longer than the reference results.
+        const std::string inputFilePath = _results->GetInputFilePath();
+        const std::vector<cIssue *> issues = _issueFilter.GetContainerIssues();
 
-        if (!result)
-        {
-            QString errormsg = QString("StartViewer failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
-            msgBox.setText(errormsg);
-            msgBox.exec();
-            return;
-        }
-
-        // Initilialize with xosc and xodr file
-        result = viewer->Initialize_f(_results->GetInputFilePath().c_str());
-
-        if (!result)
-        {
-            std::cout << "errormsg this side: " << viewer->GetLastErrorMessage_f() << std::endl;
-            QString errormsg = QString("Initialize failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
-            msgBox.setText(errormsg);
-            msgBox.exec();
-            return;
-        }
+        _viewerWorker->Post(cViewerWorker::START_VIEWER, [viewer, inputFilePath, issues]() {
+            // Start Viewer
+            if (!viewer->StartViewer_f())
+                return QString("StartViewer failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
 
-        // Add issues to viewer
-        auto issues = _results->GetIssues(_results->GetCheckers(NULL));
-        for (const auto &issue : issues)
-        {
-            result = viewer->AddIssue_f(issue);
+            // Initilialize with xosc and xodr file
+            if (!viewer->Initialize_f(inputFilePath.c_str()))
+                return QString("Initialize failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
 
-            if (!result)
+            // Add issues to viewer, with a single call if the viewer supports it
+            if (viewer->AddIssues_f != nullptr)
             {
-                QString errormsg = QString("Adding error failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
-                msgBox.setText(errormsg);
-                msgBox.exec();
-                return;
+                cViewerIssueRecords records(issues);
+                if (!viewer->AddIssues_f(records.GetRecords()))
+                    return QString("Adding errors failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
+            }
+            else
+            {
+                for (const auto &issue : issues)
+                {
+                    if (!viewer->AddIssue_f(issue))
+                        return QString("Adding error failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
+                }
             }
-        }
 
-        setCursor(Qt::ArrowCursor);
-        QApplication::processEvents();
+            viewer->isStarted = true;
+            return QString();
+        });
 
         _viewerActive = viewer;
     }
     else
     {
+        QMessageBox msgBox;
+        msgBox.setWindowTitle(this->_reportModuleName + " Error");
+        msgBox.setStandardButtons(QMessageBox::Ok);
         msgBox.setText("Cannot start because no XODR in result. Abort.");
         msgBox.exec();
     }
@@ -518,29 +687,67 @@ void cReportModuleWindow::StartViewer(Viewer *viewer)
 
 void cReportModuleWindow::ShowIssueInViewer(const cIssue *const issue, const cLocationsContainer *locationToShow)
 {
-    QMessageBox msgBox;
-    msgBox.setWindowTitle(this->_reportModuleName + " Error");
-    msgBox.setStandardButtons(QMessageBox::Ok);
+    if (_viewerActive == nullptr || issue == nullptr)
+        return;
 
-    if (_viewerActive != nullptr)
+    // Fixed issues belong to the reference results, which the viewer does not know, see StartViewer()
+    if (issue->GetChecker()->GetCheckerBundle()->GetResultContainer() != _results)
+        return;
+
+    // Requests for a viewer which could not be started are dropped
+    Viewer *viewer = _viewerActive;
+    _viewerWorker->Post(cViewerWorker::SHOW_ISSUE, [viewer, issue, locationToShow]() {
+        if (!viewer->isStarted || viewer->ShowIssue_f(issue, locationToShow))
+            return QString();
+
+        return QString("Show issue failed, abort. Error msg: ") + viewer->GetLastErrorMessage_f();
+    });
+}
+
+void cReportModuleWindow::OnViewerRequestFinished(int type, const QString &error)
+{
+    if (type == cViewerWorker::START_VIEWER)
+        setCursor(Qt::ArrowCursor);
+
+    if (error.isEmpty())
+        return;
+
+    if (type == cViewerWorker::CLOSE_VIEWER)
     {
-        bool result = _viewerActive->ShowIssue_f(issue, locationToShow);
-        if (!result)
-        {
-            QString errormsg =
-                QString("Show issue failed, abort. Error msg: ") + _viewerActive->GetLastErrorMessage_f();
-            msgBox.setText(errormsg);
-            msgBox.exec();
-        }
+        LogError() << error.toStdString();
+        return;
     }
+
+    if (type == cViewerWorker::START_VIEWER)
+        _viewerActive = nullptr;
+
+    QMessageBox msgBox;
+    msgBox.setWindowTitle(this->_reportModuleName + " Error");
+    msgBox.setStandardButtons(QMessageBox::Ok);
+    msgBox.setText(error);
+    msgBox.exec();
 }
 
 void cReportModuleWindow::closeEvent(QCloseEvent *)
 {
+    // Also wait for loaders which were cancelled, but have not finished yet
+    for (cResultLoader *loader : findChildren<cResultLoader *>())
+    {
+        loader->Cancel();
+        loader->wait();
+    }
+
+    // The viewers are closed after the queued requests
     for (uint32_t i = 0; i < viewerEntries.size(); i++)
     {
-        viewerEntries[i]->CloseViewer_f();
+        Viewer *viewer = viewerEntries[i].get();
+        _viewerWorker->Post(cViewerWorker::CLOSE_VIEWER, [viewer]() {
+            viewer->CloseViewer_f();
+            return QString();
+        });
     }
+
+    _viewerWorker->Finish();
 }
 
 void cReportModuleWindow::dragEnterEvent(QDragEnterEvent *event)
@@ -554,49 +761,176 @@ void cReportModuleWindow::dragEnterEvent(QDragEnterEvent *event)
 
 void cReportModuleWindow::FilterResultsOnCheckboxes()
 {
+    _issueFilter.SetState(GetFilterState());
+
+    if (_checkerWidget != nullptr)
+        _checkerWidget->UpdateFilter();
+}
+
+int cReportModuleWindow::GetFilterState() const
+{
+    return (_repetitiveIssueEnabled ? cIssueFilter::SHOW_REPETITIVE_ISSUES : 0) |
+           (_infoLevelEnabled ? cIssueFilter::SHOW_INFO_LEVEL : 0) |
+           (_warningLevelEnabled ? cIssueFilter::SHOW_WARNING_LEVEL : 0) |
+           (_errorLevelEnabled ? cIssueFilter::SHOW_ERROR_LEVEL : 0) |
+           (_newIssuesEnabled ? cIssueFilter::SHOW_NEW_ISSUES : 0) |
+           (_fixedIssuesEnabled ? cIssueFilter::SHOW_FIXED_ISSUES : 0) |
+           (_unchangedIssuesEnabled ? cIssueFilter::SHOW_UNCHANGED_ISSUES : 0);
+}
+
+void cReportModuleWindow::LoadResultFromFilepath(const QString &filePath)
+{
+    if (filePath.isEmpty())
+        return;
 
-    std::unordered_map<eIssueLevel, bool> filterMap = {{eIssueLevel::INFO_LVL, _infoLevelEnabled},
-                                                       {eIssueLevel::WARNING_LVL, _warningLevelEnabled},
-                                                       {eIssueLevel::ERROR_LVL, _errorLevelEnabled}};
-    std::unordered_set<std::string> found_rule_ids;
+    // A file which is still read is replaced by the new one
+    if (_resultLoader != nullptr)
+        _resultLoader->Cancel();
 
-    for (const auto &itBundle : _results->GetCheckerBundles())
+    _resultLoader = new cResultLoader(filePath, this);
+
+    connect(_resultLoader, &cResultLoader::Progress, this, &cReportModuleWindow::OnLoadProgress);
+    connect(_resultLoader, &QThread::finished, this, &cReportModuleWindow::OnResultsLoaded);
+
+    _loadProgressBar->setValue(0);
+    _loadProgressBar->setVisible(true);
+    _cancelLoadButton->setVisible(true);
+    statusBar()->showMessage(tr("Reading %1 ...").arg(filePath));
+
+    _resultLoader->start();
+}
+
+void cReportModuleWindow::OnLoadProgress(int percent)
+{
+    if (sender() == _resultLoader || sender() == _compareLoader)
+        _loadProgressBar->setValue(percent);
+}
+
+void cReportModuleWindow::CancelLoading()
+{
+    if (_resultLoader != nullptr)
+        _resultLoader->Cancel();
+
+    if (_compareLoader != nullptr)
+        _compareLoader->Cancel();
+}
+
+void cReportModuleWindow::OnDensitySelectionChanged()
+{
+    cIssueFilter::tBitset issues;
+    if (_densityMap->GetSelectedIssues(issues))
     {
-        std::list<cChecker *> checkers = itBundle->GetCheckers();
-        for (const auto &itChecker : checkers)
-        {
-            std::list<cIssue *> issues = itChecker->GetIssues();
-            for (const auto &itIssue : issues)
-            {
-                bool enabled_level_in_checkbox = filterMap[itIssue->GetIssueLevel()];
-                bool rule_uid_already_found = false;
-                if (itIssue->GetRuleUID() != "" && itIssue->GetRuleUID() != " ")
-                {
-                    auto result = found_rule_ids.insert(itIssue->GetRuleUID());
-                    rule_uid_already_found = !result.second;
-                }
-                bool is_visible = enabled_level_in_checkbox;
-                if (!_repetitiveIssueEnabled)
-                {
-                    is_visible = is_visible && !rule_uid_already_found;
-                }
-                itIssue->SetEnabled(is_visible);
-            }
-        }
+        _issueFilter.SetRegion(std::move(issues));
+        _fileViewer->ScrollToLine((_densityMap->GetSelectionBegin() + _densityMap->GetSelectionEnd()) / 2);
     }
+    else
+        _issueFilter.ClearRegion();
+
+    if (_checkerWidget != nullptr)
+        _checkerWidget->UpdateFilter();
 }
-void cReportModuleWindow::LoadResultFromFilepath(const QString &filePath)
+
+void cReportModuleWindow::OnResultsLoaded()
 {
-    if (!filePath.isNull())
+    cResultLoader *loader = qobject_cast<cResultLoader *>(sender());
+    if (nullptr == loader)
+        return;
+
+    loader->deleteLater();
+
+    // Results of a replaced loader are dropped
+    if (loader != _resultLoader)
+        return;
+
+    _resultLoader = nullptr;
+    UpdateProgressVisibility();
+
+    // The shown results are kept if the file cannot be read
+    if (loader->HasFailed())
+    {
+        ShowLoadError(tr("Could not read result file %1").arg(loader->GetFilePath()));
+        return;
+    }
+
+    if (!loader->IsCompleted())
+    {
+        statusBar()->showMessage(tr("Reading %1 cancelled").arg(loader->GetFilePath()), 5000);
+        return;
+    }
+
+    // A comparison refers to the previous results
+    CancelComparison();
+
+    // The shown container keeps its address, because the widgets and viewers refer to it. The previous results
+    // are freed after the widgets show the new ones.
+    std::unique_ptr<cResultContainer> previousResults(loader->TakeResults());
+    _results->Swap(*previousResults);
+
+    // The filter refers to the issues, which are now owned by _results. The checkboxes may have changed while the
+    // file was read.
+    _issueFilter = loader->TakeIssueFilter();
+    _issueFilter.SetState(GetFilterState());
+
+    LoadResultContainer(_results);
+
+    // Queued viewer requests refer to the previous issues, so they are freed after them
+    _viewerWorker->ReleaseAfterRequests(std::move(previousResults));
+    _viewerWorker->ReleaseAfterRequests(std::move(_referenceResults));
+    UpdateComparisonCheckboxes();
+    statusBar()->clearMessage();
+}
+
+void cReportModuleWindow::OnComparisonLoaded()
+{
+    cResultLoader *loader = qobject_cast<cResultLoader *>(sender());
+    if (nullptr == loader)
+        return;
+
+    loader->deleteLater();
+
+    // Results of a replaced loader are dropped
+    if (loader != _compareLoader)
+        return;
+
+    _compareLoader = nullptr;
+    UpdateProgressVisibility();
+
+    if (loader->HasFailed())
     {
-        // clear old results
-        _results->Clear();
-        // load new one
-        _results->AddResultsFromXML(filePath.toUtf8().constData());
+        ShowLoadError(tr("Could not read reference file %1").arg(loader->GetFilePath()));
+        return;
+    }
 
-        FilterResultsOnCheckboxes();
-        LoadResultContainer(_results);
+    if (!loader->IsCompleted())
+    {
+        statusBar()->showMessage(tr("Comparing with %1 cancelled").arg(loader->GetFilePath()), 5000);
+        return;
     }
+
+    // The previous reference is freed after the widgets show the new filter
+    std::unique_ptr<cResultContainer> previousReference(std::move(_referenceResults));
+    _referenceResults.reset(loader->TakeResults());
+
+    _issueFilter = loader->TakeIssueFilter();
+    _issueFilter.SetState(GetFilterState());
+
+    LoadResultContainer(_results);
+
+    // Queued viewer requests may refer to fixed issues of the previous reference, so it is freed after them
+    _viewerWorker->ReleaseAfterRequests(std::move(previousReference));
+    UpdateComparisonCheckboxes();
+    statusBar()->showMessage(tr("Compared with %1").arg(loader->GetFilePath()));
+}
+
+void cReportModuleWindow::ShowLoadError(const QString &message)
+{
+    statusBar()->showMessage(message, 5000);
+
+    QMessageBox msgBox;
+    msgBox.setWindowTitle(this->_reportModuleName + " Error");
+    msgBox.setStandardButtons(QMessageBox::Ok);
+    msgBox.setText(message);
+    msgBox.exec();
 }
 
 void cReportModuleWindow::dropEvent(QDropEvent *event)
@@ -629,28 +963,37 @@ void cReportModuleWindow::onIssueToggled(bool checked)
 {
     _repetitiveIssueEnabled = checked;
     FilterResultsOnCheckboxes();
-    if (_checkerWidget != nullptr)
-        _checkerWidget->UpdateResultContainer(_results);
 }
 void cReportModuleWindow::onInfoToggled(bool checked)
 {
     _infoLevelEnabled = checked;
     FilterResultsOnCheckboxes();
-    if (_checkerWidget != nullptr)
-        _checkerWidget->UpdateResultContainer(_results);
 }
 void cReportModuleWindow::onWarningToggled(bool checked)
 {
     _warningLevelEnabled = checked;
     FilterResultsOnCheckboxes();
-    if (_checkerWidget != nullptr)
-        _checkerWidget->UpdateResultContainer(_results);
 }
 void cReportModuleWindow::onErrorToggled(bool checked)
 {
     _errorLevelEnabled = checked;
     FilterResultsOnCheckboxes();
+}
 
-    if (_checkerWidget != nullptr)
-        _checkerWidget->UpdateResultContainer(_results);
+void cReportModuleWindow::onNewIssuesToggled(bool checked)
+{
+    _newIssuesEnabled = checked;
+    FilterResultsOnCheckboxes();
+}
+
+void cReportModuleWindow::onFixedIssuesToggled(bool checked)
+{
+    _fixedIssuesEnabled = checked;
+    FilterResultsOnCheckboxes();
+}
+
+void cReportModuleWindow::onUnchangedIssuesToggled(bool checked)
+{
+    _unchangedIssuesEnabled = checked;
+    FilterResultsOnCheckboxes();
 }
@@ -13,26 +13,31 @@
 #include <QDragEnterEvent>
 #include <QDropEvent>
 #include <QMap>
-#include <QPlainTextEdit>
 #include <QString>
 #include <QtWidgets/QMainWindow>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include "c_line_highlighter.h"
+#include "c_issue_filter.h"
 #include "common/result_format/c_issue.h"
 
 class cCheckerBundle;
 class cCheckerWidget;
+class cFileViewer;
+class cIssueDensityMap;
 class cXODREditorWidget;
 class cXOSCEditorWidget;
 class cResultContainer;
 class cLocationsContainer;
+class cResultLoader;
+class cViewerWorker;
 
 class QActionGroup;
 class QMenu;
 class QAction;
+class QProgressBar;
+class QPushButton;
 
 class cReportModuleWindow : public QMainWindow
 {
@@ -53,6 +58,7 @@ class cReportModuleWindow : public QMainWindow
     typedef bool (*StartViewer_ptr)();
     typedef bool (*Initialize_ptr)(const char *);
     typedef bool (*AddIssue_ptr)(const void *);
+    typedef bool (*AddIssues_ptr)(const void *);
     typedef bool (*ShowIssue_ptr)(const void *, const void *);
     typedef const char *(*GetName_ptr)();
     typedef bool (*CloseViewer_ptr)();
@@ -63,24 +69,55 @@ class cReportModuleWindow : public QMainWindow
         StartViewer_ptr StartViewer_f{nullptr};
         Initialize_ptr Initialize_f{nullptr};
         AddIssue_ptr AddIssue_f{nullptr};
+        AddIssues_ptr AddIssues_f{nullptr};
         ShowIssue_ptr ShowIssue_f{nullptr};
         GetName_ptr GetName_f{nullptr};
         CloseViewer_ptr CloseViewer_f{nullptr};
         GetLastErrorMessage_ptr GetLastErrorMessage_f{nullptr};
         QAction *associatedAction{nullptr};
+        // True if the viewer was started successfully. Only accessed on the viewer worker thread.
+        bool isStarted{false};
     };
 
     std::vector<std::unique_ptr<Viewer>> viewerEntries;
     Viewer *_viewerActive{nullptr};
+    // Thread which calls the functions of the viewer plugins
+    cViewerWorker *_viewerWorker{nullptr};
     void dragEnterEvent(QDragEnterEvent *event) override;
     void dropEvent(QDropEvent *event) override;
-    LineHighlighter *highlighter;
-    QPlainTextEdit *textEditArea;
+    cFileViewer *_fileViewer{nullptr};
+    // Density of the issues along the input file
+    cIssueDensityMap *_densityMap{nullptr};
     const QFont codeFont = getCodeFont();
     bool _repetitiveIssueEnabled;
     bool _infoLevelEnabled;
     bool _warningLevelEnabled;
     bool _errorLevelEnabled;
+    bool _newIssuesEnabled{true};
+    bool _fixedIssuesEnabled{true};
+    bool _unchangedIssuesEnabled{true};
+
+    // Checkboxes of the classes of a comparison, only visible while results are compared
+    QWidget *_comparisonCheckboxWidget{nullptr};
+    QCheckBox *_newIssuesCheckBox{nullptr};
+    QCheckBox *_fixedIssuesCheckBox{nullptr};
+    QCheckBox *_unchangedIssuesCheckBox{nullptr};
+    QAction *_closeComparisonAct{nullptr};
+    QAction *_saveAct{nullptr};
+
+    // Filter of the issues of _results by the checkboxes
+    cIssueFilter _issueFilter;
+
+    // Loader of the result file which is currently read, nullptr if no file is read
+    cResultLoader *_resultLoader{nullptr};
+
+    // Loader of the reference file which is currently compared with _results, nullptr if no file is compared
+    cResultLoader *_compareLoader{nullptr};
+
+    // Results which _results are compared with. The fixed issues of _issueFilter refer to them.
+    std::unique_ptr<cResultContainer> _referenceResults;
+    QProgressBar *_loadProgressBar{nullptr};
+    QPushButton *_cancelLoadButton{nullptr};
 
   public:
     cReportModuleWindow() = delete;
@@ -88,26 +125,53 @@ class cReportModuleWindow : public QMainWindow
     cReportModuleWindow(const cReportModuleWindow &) = delete;
     explicit cReportModuleWindow(cResultContainer *container, const std::string &reportModuleName, QWidget *parent = 0);
 
-    virtual ~cReportModuleWindow() = default;
+    virtual ~cReportModuleWindow();
 
     // Loads the result container
-    void LoadResultContainer(cResultContainer *const container) const;
+    void LoadResultContainer(cResultContainer *const container);
 
   private slots:
     // Open result file
     void OpenResultFile();
     void SaveResultFile();
 
+    // Compares the shown results with a reference result file
+    void CompareResultFile();
+
+    // Shows the results without comparison
+    void CloseComparison();
+
     // starts the Viewer
     void StartViewer(Viewer *viewer);
 
     // shows a XODR Issue in a viewer if available
     void ShowIssueInViewer(const cIssue *const issue, const cLocationsContainer *locationToShow);
 
+    // Reports the result of a call of a viewer plugin
+    void OnViewerRequestFinished(int type, const QString &error);
+
     void onIssueToggled(bool checked);
     void onInfoToggled(bool checked);
     void onWarningToggled(bool checked);
     void onErrorToggled(bool checked);
+    void onNewIssuesToggled(bool checked);
+    void onFixedIssuesToggled(bool checked);
+    void onUnchangedIssuesToggled(bool checked);
+
+    // Updates the progress bar while a result file is read
+    void OnLoadProgress(int percent);
+
+    // Replaces the shown results when a result file was read
+    void OnResultsLoaded();
+
+    // Shows the comparison with a reference file when the file was read and compared
+    void OnComparisonLoaded();
+
+    // Cancels reading the result file
+    void CancelLoading();
+
+    // Restricts the shown issues to the lines selected in the density map
+    void OnDensitySelectionChanged();
 
   private:
     // Handle application close
@@ -118,10 +182,29 @@ class cReportModuleWindow : public QMainWindow
                            const std::string &parameter, const std::string &fileName) const;
 
     QFont getCodeFont();
+
+    // Reads a result file on a loader thread. The shown results stay available until the file was read.
     void LoadResultFromFilepath(const QString &filePath);
+
+    // Stops comparing with a reference file which is still read
+    void CancelComparison();
+
+    // Shows the progress bar while a result file is read or compared and disables saving during a comparison
+    void UpdateProgressVisibility();
+
+    // Shows an error of reading a result or reference file in the status bar and a message box
+    void ShowLoadError(const QString &message);
+
+    // Shows the checkboxes of the comparison classes while results are compared
+    void UpdateComparisonCheckboxes();
+
+    // Applies the checkbox state to the issue filter and updates the shown issues
     void FilterResultsOnCheckboxes();
 
+    // Returns the state of the filter checkboxes as combination of the cIssueFilter::SHOW_ bits
+    int GetFilterState() const;
+
   public slots:
     void loadFileContent(cResultContainer *const container);
-    void highlightRow(const cIssue *const issue, const int row);
+    void highlightRows(const cIssue *const issue, const QList<int> &rows);
 };
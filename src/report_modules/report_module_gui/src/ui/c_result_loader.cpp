@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_result_loader.h"
+
+#include "common/result_format/c_result_container.h"
+#include "common/result_format/c_result_diff.h"
+
+cResultLoader::cResultLoader(const QString &filePath, QObject *parent)
+    : QThread(parent), m_FilePath(filePath), m_Cancelled(false), m_Completed(false), m_Failed(false),
+      m_LastPercent(-1)
+{
+}
+
+cResultLoader::~cResultLoader()
+{
+    Cancel();
+    wait();
+}
+
+void cResultLoader::SetComparedResults(cResultContainer *results)
+{
+    m_ComparedResults = results;
+}
+
+void cResultLoader::Cancel()
+{
+    m_Cancelled = true;
+}
+
+bool cResultLoader::IsCompleted() const
+{
+    return m_Completed;
+}
+
+bool cResultLoader::HasFailed() const
+{
+    return m_Failed;
+}
+
+const QString &cResultLoader::GetFilePath() const
+{
+    return m_FilePath;
+}
+
+cResultContainer *cResultLoader::TakeResults()
+{
+    return m_Results.release();
+}
+
+cIssueFilter cResultLoader::TakeIssueFilter()
+{
+    return std::move(m_IssueFilter);
+}
+
+void cResultLoader::run()
+{
+    m_Results.reset(new cResultContainer());
+
+    auto progress = [this](uint64_t bytesRead, uint64_t bytesTotal) {
+        const int percent = (bytesTotal > 0) ? (int)(bytesRead * 100 / bytesTotal) : 100;
+
+        // Only changes are reported, so the UI thread is not flooded with events
+        if (percent != m_LastPercent)
+        {
+            m_LastPercent = percent;
+            emit Progress(percent);
+        }
+
+        return !m_Cancelled;
+    };
+
+    const bool completed = m_Results->AddResultsFromXML(m_FilePath.toUtf8().constData(), progress);
+
+    if (completed && !m_Cancelled)
+    {
+        if (nullptr != m_ComparedResults)
+        {
+            // The issues are matched by fingerprint with a hash join
+            cResultDiff comparison;
+            comparison.Compare(*m_Results, *m_ComparedResults);
+            m_IssueFilter.Build(m_ComparedResults, &comparison);
+        }
+        else
+            m_IssueFilter.Build(m_Results.get());
+    }
+
+    m_Completed = completed && !m_Cancelled;
+    m_Failed = !completed && !m_Cancelled;
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef RESULT_LOADER_H
+#define RESULT_LOADER_H
+
+#include <QtCore/QString>
+#include <QtCore/QThread>
+
+#include <atomic>
+#include <memory>
+
+#include "c_issue_filter.h"
+
+class cResultContainer;
+
+/*
+ * Thread which reads a result file into a new result container, so the window stays responsive while large files
+ * are read. The progress is reported in percent of the bytes read. After reading, the issue filter of the results is
+ * built on the thread as well. When the thread has finished, the results and the filter are taken with TakeResults()
+ * and TakeIssueFilter() on the UI thread.
+ *
+ * To compare results, the file is read as reference for other results, which are set with SetComparedResults(). The
+ * issue filter is then built for the compared results and contains the comparison with the reference.
+ */
+class cResultLoader : public QThread
+{
+    Q_OBJECT
+
+  public:
+    cResultLoader(const QString &filePath, QObject *parent = nullptr);
+    ~cResultLoader();
+
+    /*
+     * Compares the read results as reference with other results. Has to be called before the thread is started.
+     * \param results: Results to compare. They are read on the thread and must not be modified until it has finished.
+     */
+    void SetComparedResults(cResultContainer *results);
+
+    // Requests to stop reading. The thread finishes as soon as the parser reads the next block.
+    void Cancel();
+
+    // Returns true if the file was read completely and the loading was not cancelled
+    bool IsCompleted() const;
+
+    // Returns true if the file is missing or could not be parsed. Only valid after the thread has finished.
+    bool HasFailed() const;
+
+    // Returns the path of the result file
+    const QString &GetFilePath() const;
+
+    // Returns the loaded results and passes the ownership to the caller. Only valid after the thread has finished.
+    cResultContainer *TakeResults();
+
+    // Returns the issue filter built for the loaded results, or for the compared results if they are set. Only valid
+    // after the thread has finished.
+    cIssueFilter TakeIssueFilter();
+
+  signals:
+    // Invoked when the progress has changed
+    void Progress(int percent);
+
+  protected:
+    void run() override;
+
+  private:
+    QString m_FilePath;
+    std::unique_ptr<cResultContainer> m_Results;
+    cResultContainer *m_ComparedResults{nullptr};
+    cIssueFilter m_IssueFilter;
+
+    std::atomic<bool> m_Cancelled;
+    bool m_Completed;
+    bool m_Failed;
+    int m_LastPercent;
+};
+
+#endif
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_viewer_issue_records.h"
+
+#include "common/result_format/c_inertial_location.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_locations_container.h"
+#include "common/result_format/c_time_location.h"
+
+cViewerIssueRecords::cViewerIssueRecords(const std::vector<cIssue *> &issues)
+{
+    std::unordered_map<std::string, uint32_t> ruleIndices;
+    std::unordered_map<std::string, uint32_t> descriptionIndices;
+
+    m_Records.reserve(issues.size());
+
+    for (const cIssue *issue : issues)
+    {
+        tViewerIssueRecord record = {};
+        record.issue = issue;
+        record.issueId = issue->GetIssueId();
+        record.level = (uint32_t)issue->GetIssueLevel();
+        record.locationIndex = VIEWER_NO_INDEX;
+        record.locationType = VIEWER_LOCATION_NONE;
+
+        const std::string ruleUID = issue->GetRuleUID();
+        record.ruleIndex = ruleUID.empty() ? VIEWER_NO_INDEX : AddString(ruleUID, m_Rules, ruleIndices);
+        record.descriptionIndex = AddString(issue->GetDescription(), m_Descriptions, descriptionIndices);
+
+        const std::size_t firstRecord = m_Records.size();
+        uint32_t locationIndex = 0;
+
+        for (const auto location : issue->GetLocationsContainer())
+        {
+            for (auto extendedInformation : location->GetExtendedInformations())
+            {
+                tViewerIssueRecord locationRecord = record;
+                locationRecord.locationIndex = locationIndex;
+
+                if (extendedInformation->IsType<cInertialLocation *>())
+                {
+                    const cInertialLocation *inertialLocation = (cInertialLocation *)extendedInformation;
+                    locationRecord.locationType = VIEWER_LOCATION_INERTIAL;
+                    locationRecord.x = inertialLocation->GetX();
+                    locationRecord.y = inertialLocation->GetY();
+                    locationRecord.z = inertialLocation->GetZ();
+                }
+                else if (extendedInformation->IsType<cTimeLocation *>())
+                {
+                    locationRecord.locationType = VIEWER_LOCATION_TIME;
+                    locationRecord.time = ((cTimeLocation *)extendedInformation)->GetTime();
+                }
+                else
+                    continue;
+
+                m_Records.push_back(locationRecord);
+            }
+
+            ++locationIndex;
+        }
+
+        // Issues without inertial or time location are passed as well
+        if (m_Records.size() == firstRecord)
+            m_Records.push_back(record);
+    }
+
+    for (const std::string &rule : m_Rules)
+        m_RulePointers.push_back(rule.c_str());
+    for (const std::string &description : m_Descriptions)
+        m_DescriptionPointers.push_back(description.c_str());
+
+    m_IssueRecords.version = VIEWER_ISSUE_RECORDS_VERSION;
+    m_IssueRecords.recordSize = (uint32_t)sizeof(tViewerIssueRecord);
+    m_IssueRecords.recordCount = m_Records.size();
+    m_IssueRecords.records = m_Records.data();
+    m_IssueRecords.ruleCount = (uint32_t)m_Rules.size();
+    m_IssueRecords.descriptionCount = (uint32_t)m_Descriptions.size();
+    m_IssueRecords.rules = m_RulePointers.data();
+    m_IssueRecords.descriptions = m_DescriptionPointers.data();
+}
+
+const tViewerIssueRecords *cViewerIssueRecords::GetRecords() const
+{
+    return &m_IssueRecords;
+}
+
+uint32_t cViewerIssueRecords::AddString(const std::string &value, std::vector<std::string> &table,
+                                        std::unordered_map<std::string, uint32_t> &indices)
+{
+    auto it = indices.find(value);
+    if (it != indices.end())
+        return it->second;
+
+    const uint32_t index = (uint32_t)table.size();
+    indices.emplace(value, index);
+    table.push_back(value);
+    return index;
+}
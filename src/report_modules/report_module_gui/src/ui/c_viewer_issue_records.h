@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef VIEWER_ISSUE_RECORDS_H
+#define VIEWER_ISSUE_RECORDS_H
+
+#include "viewer/i_connector.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class cIssue;
+
+/*
+ * Converts issues into the flat records which are passed to the AddIssues function of viewer plugins. The records
+ * and the string tables are owned by this class.
+ */
+class cViewerIssueRecords
+{
+  public:
+    cViewerIssueRecords(const std::vector<cIssue *> &issues);
+
+    cViewerIssueRecords(const cViewerIssueRecords &) = delete;
+    cViewerIssueRecords &operator=(const cViewerIssueRecords &) = delete;
+
+    // Returns the records for AddIssues. They are valid as long as this object exists.
+    const tViewerIssueRecords *GetRecords() const;
+
+  private:
+    // Returns the index of a string in a table and adds it if necessary
+    static uint32_t AddString(const std::string &value, std::vector<std::string> &table,
+                              std::unordered_map<std::string, uint32_t> &indices);
+
+    std::vector<tViewerIssueRecord> m_Records;
+    std::vector<std::string> m_Rules;
+    std::vector<std::string> m_Descriptions;
+
+    std::vector<const char *> m_RulePointers;
+    std::vector<const char *> m_DescriptionPointers;
+
+    tViewerIssueRecords m_IssueRecords;
+};
+
+#endif
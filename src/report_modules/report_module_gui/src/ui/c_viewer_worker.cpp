@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_viewer_worker.h"
+
+#include <algorithm>
+
+cViewerWorker::cViewerWorker(QObject *parent) : QThread(parent)
+{
+}
+
+cViewerWorker::~cViewerWorker()
+{
+    Finish();
+}
+
+void cViewerWorker::Post(eRequestType type, tRequest request)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // A ShowIssue request which was not started yet is superseded by the new one
+        if (type == SHOW_ISSUE && !m_Requests.empty() && m_Requests.back().type == SHOW_ISSUE)
+            m_Requests.back().request = std::move(request);
+        else
+            m_Requests.push_back({type, std::move(request)});
+    }
+
+    m_Condition.notify_all();
+}
+
+void cViewerWorker::ReleaseAfterRequests(std::shared_ptr<void> object)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        m_Requests.erase(std::remove_if(m_Requests.begin(), m_Requests.end(),
+                                        [](const sRequest &request) { return request.type == SHOW_ISSUE; }),
+                         m_Requests.end());
+
+        if (!object)
+            return;
+
+        // The object is freed by the request itself, so the mutex is not held meanwhile
+        m_Requests.push_back({RELEASE_OBJECT, [object]() mutable {
+                                  object.reset();
+                                  return QString();
+                              }});
+    }
+
+    m_Condition.notify_all();
+}
+
+void cViewerWorker::Finish()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+
+    m_Condition.notify_all();
+    wait();
+}
+
+void cViewerWorker::run()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    while (true)
+    {
+        m_Condition.wait(lock, [this]() { return !m_Requests.empty() || m_Stopping; });
+
+        if (m_Requests.empty())
+            break;
+
+        sRequest request = std::move(m_Requests.front());
+        m_Requests.pop_front();
+
+        // Requests can be posted while a plugin function runs
+        lock.unlock();
+        const QString error = request.request();
+        emit RequestFinished((int)request.type, error);
+        lock.lock();
+    }
+}
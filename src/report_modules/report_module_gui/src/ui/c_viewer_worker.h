@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef VIEWER_WORKER_H
+#define VIEWER_WORKER_H
+
+#include <QtCore/QString>
+#include <QtCore/QThread>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/*
+ * Thread which calls the functions of viewer plugins, so slow plugins do not block the window. Requests are executed
+ * one after another in the order they were posted. A queued ShowIssue request which has not started yet is replaced
+ * by a newer one, so the viewer only shows the latest selection.
+ *
+ * The result of every request is reported with the RequestFinished signal.
+ */
+class cViewerWorker : public QThread
+{
+    Q_OBJECT
+
+  public:
+    enum eRequestType
+    {
+        START_VIEWER,
+        SHOW_ISSUE,
+        CLOSE_VIEWER,
+        RELEASE_OBJECT
+    };
+
+    // Calls plugin functions on the worker thread. Returns an error message, or an empty string on success.
+    typedef std::function<QString()> tRequest;
+
+    cViewerWorker(QObject *parent = nullptr);
+    ~cViewerWorker();
+
+    // Queues a request
+    void Post(eRequestType type, tRequest request);
+
+    /*
+     * Drops the queued ShowIssue requests and frees an object on the worker thread after the running and the
+     * remaining requests are done, e.g. the results the requests refer to. Does not block.
+     * \param object: The object to free
+     */
+    void ReleaseAfterRequests(std::shared_ptr<void> object);
+
+    // Executes the queued requests and stops the thread. Blocks until all requests are done.
+    void Finish();
+
+  signals:
+    // Invoked after a request was executed. The error is empty on success.
+    void RequestFinished(int type, const QString &error);
+
+  protected:
+    void run() override;
+
+  private:
+    struct sRequest
+    {
+        eRequestType type;
+        tRequest request;
+    };
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::deque<sRequest> m_Requests;
+    bool m_Stopping{false};
+};
+
+#endif
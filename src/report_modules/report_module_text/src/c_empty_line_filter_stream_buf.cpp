@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_empty_line_filter_stream_buf.h"
+
+#include <cctype>
+#include <cstring>
+
+cEmptyLineFilterStreamBuf::cEmptyLineFilterStreamBuf(std::streambuf *target)
+    : m_Target(target), m_LineHasContent(false)
+{
+}
+
+void cEmptyLineFilterStreamBuf::Finish()
+{
+    if (m_LineHasContent)
+        m_Target->sputc('\n');
+
+    m_PendingWhitespace.clear();
+    m_LineHasContent = false;
+}
+
+cEmptyLineFilterStreamBuf::int_type cEmptyLineFilterStreamBuf::overflow(int_type ch)
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+        return traits_type::not_eof(ch);
+
+    const char c = traits_type::to_char_type(ch);
+    xsputn(&c, 1);
+    return ch;
+}
+
+std::streamsize cEmptyLineFilterStreamBuf::xsputn(const char *s, std::streamsize count)
+{
+    std::streamsize pos = 0;
+    while (pos < count)
+    {
+        if (m_LineHasContent)
+        {
+            // Forward everything up to and including the end of the line at once
+            const char *lineEnd = static_cast<const char *>(std::memchr(s + pos, '\n', (std::size_t)(count - pos)));
+            const std::streamsize end = (lineEnd != nullptr) ? (lineEnd - s) + 1 : count;
+
+            m_Target->sputn(s + pos, end - pos);
+            pos = end;
+
+            if (lineEnd != nullptr)
+                m_LineHasContent = false;
+            continue;
+        }
+
+        const char c = s[pos++];
+        if (c == '\n')
+        {
+            // Line without content
+            m_PendingWhitespace.clear();
+        }
+        else if (std::isspace((unsigned char)c))
+        {
+            m_PendingWhitespace += c;
+        }
+        else
+        {
+            m_Target->sputn(m_PendingWhitespace.data(), (std::streamsize)m_PendingWhitespace.size());
+            m_Target->sputc(c);
+            m_PendingWhitespace.clear();
+            m_LineHasContent = true;
+        }
+    }
+
+    return count;
+}
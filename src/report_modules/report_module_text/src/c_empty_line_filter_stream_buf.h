@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cEmptyLineFilterStreamBuf_h__
+#define cEmptyLineFilterStreamBuf_h__
+
+#include <streambuf>
+#include <string>
+
+/*
+ * Stream buffer which forwards everything written to it to a target stream buffer, but drops lines which are empty
+ * or contain only whitespace. Every forwarded line ends with a newline, also the last one after Finish().
+ *
+ * Only leading whitespace of the current line is held back, so the memory use does not depend on the amount of
+ * text which is written.
+ */
+class cEmptyLineFilterStreamBuf : public std::streambuf
+{
+  public:
+    /*
+     * Creates a new filter
+     * \param target: The stream buffer which receives the filtered output
+     */
+    explicit cEmptyLineFilterStreamBuf(std::streambuf *target);
+
+    // Terminates the current line. Has to be called after the last write.
+    void Finish();
+
+  protected:
+    virtual int_type overflow(int_type ch) override;
+
+    virtual std::streamsize xsputn(const char *s, std::streamsize count) override;
+
+  private:
+    std::streambuf *m_Target;
+
+    // Whitespace at the start of the current line, which is only written if the line has content
+    std::string m_PendingWhitespace;
+
+    // True if the current line contains a non whitespace character
+    bool m_LineHasContent;
+};
+
+#endif
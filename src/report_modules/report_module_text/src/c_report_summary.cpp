@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_report_summary.h"
+
+#include "common/result_format/c_checker.h"
+#include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_result_container.h"
+
+#include <algorithm>
+
+// Orders rules by rule UID
+static bool CompareRuleUID(const tRuleCount &left, const tRuleCount &right)
+{
+    return *left.first < *right.first;
+}
+
+// Orders rules by descending issue count and by rule UID for equal counts
+static bool CompareIssueCount(const tRuleCount &left, const tRuleCount &right)
+{
+    if (left.second->GetCount() != right.second->GetCount())
+        return left.second->GetCount() > right.second->GetCount();
+
+    return *left.first < *right.first;
+}
+
+cReportSummary::cReportSummary() : m_IssueCount(0)
+{
+}
+
+void cReportSummary::Collect(cResultContainer *results)
+{
+    m_RuleCounts.clear();
+    m_IssuesWithoutRule.Reset();
+    m_IssueCount = 0;
+
+    results->DoProcessing(
+        [this](cCheckerBundle *, cChecker *, cIssue *issue) {
+            const std::string strRuleUID = issue->GetRuleUID();
+
+            if (strRuleUID.empty())
+                m_IssuesWithoutRule.Add(issue->GetIssueLevel(), issue->IsEnabled());
+            else
+                m_RuleCounts[strRuleUID].Add(issue->GetIssueLevel(), issue->IsEnabled());
+
+            m_IssueCount++;
+        },
+        eExecutionPolicy::SEQUENTIAL);
+}
+
+unsigned int cReportSummary::GetIssueCount() const
+{
+    return m_IssueCount;
+}
+
+const cIssueCounter &cReportSummary::GetIssuesWithoutRule() const
+{
+    return m_IssuesWithoutRule;
+}
+
+std::size_t cReportSummary::GetRuleCount() const
+{
+    return m_RuleCounts.size();
+}
+
+std::vector<tRuleCount> cReportSummary::GetRules() const
+{
+    std::vector<tRuleCount> rules;
+    rules.reserve(m_RuleCounts.size());
+    for (const auto &ruleCount : m_RuleCounts)
+        rules.emplace_back(&ruleCount.first, &ruleCount.second);
+
+    std::sort(rules.begin(), rules.end(), CompareRuleUID);
+    return rules;
+}
+
+std::vector<tRuleCount> cReportSummary::GetTopRules(std::size_t count) const
+{
+    std::vector<tRuleCount> rules;
+    rules.reserve(m_RuleCounts.size());
+    for (const auto &ruleCount : m_RuleCounts)
+        rules.emplace_back(&ruleCount.first, &ruleCount.second);
+
+    count = std::min(count, rules.size());
+    std::partial_sort(rules.begin(), rules.begin() + count, rules.end(), CompareIssueCount);
+    rules.resize(count);
+    return rules;
+}
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cReportSummary_h__
+#define cReportSummary_h__
+
+#include "common/result_format/c_issue_counter.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class cResultContainer;
+
+// Rule UID with the counts of its issues
+typedef std::pair<const std::string *, const cIssueCounter *> tRuleCount;
+
+/*
+ * Aggregates the issues of results per rule UID and issue level in a single pass. Counts per checker bundle and
+ * checker are kept up to date by the results themselves, see cIssueCounter.
+ */
+class cReportSummary
+{
+  public:
+    cReportSummary();
+
+    // Counts all issues of the results. Counts of previous calls are discarded.
+    void Collect(cResultContainer *results);
+
+    // Returns the count of all issues
+    unsigned int GetIssueCount() const;
+
+    // Returns the counts of issues which have no rule UID
+    const cIssueCounter &GetIssuesWithoutRule() const;
+
+    // Returns the count of rules with issues
+    std::size_t GetRuleCount() const;
+
+    // Returns all rules with issues ordered by rule UID
+    std::vector<tRuleCount> GetRules() const;
+
+    /*
+     * Returns the rules with the most issues, ordered by descending issue count and by rule UID for equal counts
+     * \param count: Maximum count of rules to return
+     */
+    std::vector<tRuleCount> GetTopRules(std::size_t count) const;
+
+  private:
+    std::unordered_map<std::string, cIssueCounter> m_RuleCounts;
+    cIssueCounter m_IssuesWithoutRule;
+    unsigned int m_IssueCount;
+};
+
+#endif
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "c_transcode_buffer.h"
+
+XERCES_CPP_NAMESPACE_USE
+
+// Initial size of the buffer, sufficient for the usual tag and attribute names
+const std::size_t INITIAL_BUFFER_SIZE = 256;
+
+// Upper bound of bytes per UTF-16 code unit in the usual multibyte code pages
+const std::size_t MAX_BYTES_PER_CHAR = 4;
+
+cTranscodeBuffer::cTranscodeBuffer() : m_Buffer(INITIAL_BUFFER_SIZE)
+{
+}
+
+const char *cTranscodeBuffer::Transcode(const XMLCh *text)
+{
+    if (text == nullptr || *text == 0)
+        return "";
+
+    const std::size_t requiredSize = XMLString::stringLen(text) * MAX_BYTES_PER_CHAR + 1;
+    if (m_Buffer.size() < requiredSize)
+        m_Buffer.resize(requiredSize);
+
+    if (XMLString::transcode(text, m_Buffer.data(), m_Buffer.size() - 1))
+        return m_Buffer.data();
+
+    // The code page needs more bytes than expected. Let Xerces compute the size.
+    char *transcoded = XMLString::transcode(text);
+    m_Fallback = (transcoded != nullptr) ? transcoded : "";
+    XMLString::release(&transcoded);
+    return m_Fallback.c_str();
+}
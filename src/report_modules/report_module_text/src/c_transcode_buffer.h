@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef cTranscodeBuffer_h__
+#define cTranscodeBuffer_h__
+
+#include <string>
+#include <vector>
+
+#include <xercesc/util/XMLString.hpp>
+
+/*
+ * Transcodes Xerces strings into the local code page like XMLString::transcode, but reuses one buffer for all
+ * strings instead of allocating a new one for each of them.
+ */
+class cTranscodeBuffer
+{
+  public:
+    cTranscodeBuffer();
+
+    /*
+     * Transcodes a string. The result stays valid until the next call.
+     * \param text: The string to transcode. nullptr is handled as empty string.
+     * \return The transcoded, zero terminated string
+     */
+    const char *Transcode(const XMLCh *text);
+
+  private:
+    std::vector<char> m_Buffer;
+
+    // Result of strings which could not be transcoded into the buffer
+    std::string m_Fallback;
+};
+
+#endif
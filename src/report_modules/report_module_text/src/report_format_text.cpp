@@ -8,6 +8,7 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 #include "report_format_text.h"
+#include "common/c_logger.h"
 #include "common/config_format/c_configuration.h"
 #include "common/config_format/c_configuration_report_module.h"
 #include "common/result_format/c_checker.h"
@@ -23,13 +24,28 @@
 #include "common/result_format/c_parameter_container.h"
 #include "common/result_format/c_result_container.h"
 #include "common/result_format/c_xml_location.h"
+#include "c_empty_line_filter_stream_buf.h"
+#include "c_report_summary.h"
+#include "c_transcode_buffer.h"
 #include "stdafx.h"
 
 #include "common/qc4openx_filesystem.h"
+#include <algorithm>
+#include <iomanip>
 #include <set>
+#include <vector>
 
 XERCES_CPP_NAMESPACE_USE
 
+// Size of the write buffer of the report file
+const std::size_t REPORT_FILE_BUFFER_SIZE = 64 * 1024;
+
+// Count of issues which are rendered as one unit of work
+const std::size_t ISSUES_PER_CHUNK = 256;
+
+// Count of chunks per thread which are rendered before they are written. Limits the memory for rendered text.
+const std::size_t CHUNKS_PER_WAVE_AND_THREAD = 4;
+
 const char BASIC_SEPARATOR_LINE[] =
     "====================================================================================================\n";
 
@@ -37,11 +53,6 @@ static std::map<eIssueLevel, std::string> mapIssueLevelToString = {{eIssueLevel:
                                                                    {eIssueLevel::WARNING_LVL, "Warning:    "},
                                                                    {eIssueLevel::ERROR_LVL, "Error:      "}};
 
-// Writes the results to the hard dis drive
-void WriteResults(const char *file, cResultContainer *ptrResultContainer);
-
-void AddPrefixForDescriptionIssueProcessor(cChecker *checker, cIssue *issueToProcess);
-
 // Main Programm
 int main(int argc, char *argv[])
 {
@@ -72,8 +83,7 @@ int main(int argc, char *argv[])
     {
         if (stat(strFilepath.c_str(), &fileStatus) == -1) // ==0 ok; ==-1 error
         {
-            std::cerr << "Could not open file '" << strFilepath << "'!" << std::endl
-                      << "Abort generating report!" << std::endl;
+            LogError() << "Could not open file '" << strFilepath << "'!\nAbort generating report!";
             return 1;
         }
 
@@ -83,10 +93,10 @@ int main(int argc, char *argv[])
     {
         cConfiguration configuration;
 
-        std::cout << "Config: " << strFilepath << std::endl;
+        LogInfo() << "Config: " << strFilepath;
         if (!cConfiguration::ParseFromXML(&configuration, strFilepath))
         {
-            std::cerr << "Could not read configuration! Abort." << std::endl;
+            LogError() << "Could not read configuration! Abort.";
             return -1;
         }
 
@@ -96,8 +106,8 @@ int main(int argc, char *argv[])
         if (nullptr != reportModuleConfig)
             inputParams.Overwrite(reportModuleConfig->GetParams());
         else
-            std::cerr << "No configuration for module '" << REPORT_MODULE_NAME << "' found. Start with default params."
-                      << std::endl;
+            LogWarning() << "No configuration for module '" << REPORT_MODULE_NAME
+                         << "' found. Start with default params.";
     }
     else if (StringEndsWith(ToLower(strFilepath), "--defaultconfig"))
     {
@@ -116,6 +126,16 @@ int main(int argc, char *argv[])
         return -1;
     }
 
+    eReportMode reportMode;
+    if (!GetReportModeFromStr(inputParams.GetParam("strReportMode", "full"), &reportMode))
+    {
+        LogError() << "Invalid report mode: " << inputParams.GetParam("strReportMode")
+                   << ". Use full, summary or top. Abort.";
+        cLogger::GetInstance().WriteSummary();
+        XMLPlatformUtils::Terminate();
+        return 1;
+    }
+
     RunTextReport(inputParams);
 }
 
@@ -142,28 +162,41 @@ void RunTextReport(const cParameterContainer &inputParams)
 
     try
     {
-        std::cout << "Read result file: '" << inputParams.GetParam("strInputFile") << "' ..." << std::endl << std::endl;
+        LogInfo() << "Read result file: '" << inputParams.GetParam("strInputFile") << "' ...\n";
 
         pResultContainer->AddResultsFromXML(inputParams.GetParam("strInputFile"));
 
-        // Add prefix with issue id
-        std::list<cCheckerBundle *> checkerBundles = pResultContainer->GetCheckerBundles();
-        for (std::list<cCheckerBundle *>::const_iterator itCheckerBundles = checkerBundles.cbegin();
-             itCheckerBundles != checkerBundles.end(); itCheckerBundles++)
-        {
-            (*itCheckerBundles)->DoProcessing(AddPrefixForDescriptionIssueProcessor);
-        }
+        // The mode is validated by main()
+        eReportMode mode = REPORT_MODE_FULL;
+        GetReportModeFromStr(inputParams.GetParam("strReportMode", "full"), &mode);
 
-        std::cout << "Write report: '" << inputParams.GetParam("strReportFile") << "'" << std::endl << std::endl;
+        LogInfo() << "Write report: '" << inputParams.GetParam("strReportFile") << "'\n";
 
-        // Gets the filename with extension from path
-        WriteResults(inputParams.GetParam("strReportFile").c_str(), pResultContainer);
+        if (mode == REPORT_MODE_FULL)
+        {
+            // Add prefix with issue id
+            pResultContainer->DoProcessing(
+                [](cCheckerBundle *, cChecker *checker, cIssue *issue) {
+                    AddPrefixForDescriptionIssueProcessor(checker, issue);
+                },
+                eExecutionPolicy::PARALLEL);
+
+            // Gets the filename with extension from path
+            WriteResults(inputParams.GetParam("strReportFile").c_str(), pResultContainer,
+                         (unsigned int)std::max(0, atoi(inputParams.GetParam("iThreadCount", "0").c_str())));
+        }
+        else
+        {
+            WriteSummaryResults(inputParams.GetParam("strReportFile").c_str(), pResultContainer, mode,
+                                (unsigned int)std::max(0, atoi(inputParams.GetParam("iTopRuleCount", "10").c_str())));
+        }
     }
     catch (...)
     {
     }
 
-    std::cout << "Finished." << std::endl;
+    LogInfo() << "Finished.";
+    cLogger::GetInstance().WriteSummary();
 
     pResultContainer->Clear();
     delete pResultContainer;
@@ -171,89 +204,119 @@ void RunTextReport(const cParameterContainer &inputParams)
     XMLPlatformUtils::Terminate();
 }
 
-void PrintDOMElement(DOMElement *element, std::stringstream &ss, int indent = 0, int startIndent = 0)
+bool GetReportModeFromStr(const std::string &strMode, eReportMode *mode)
 {
-    if (!element)
-        return;
+    const std::string strLowerMode = ToLower(strMode);
+
+    if (strLowerMode == "full")
+        *mode = REPORT_MODE_FULL;
+    else if (strLowerMode == "summary")
+        *mode = REPORT_MODE_SUMMARY;
+    else if (strLowerMode == "top")
+        *mode = REPORT_MODE_TOP;
+    else
+        return false;
 
-    // Convert the tag name to a string
-    char *tagName = XMLString::transcode(element->getTagName());
-    for (int i = 0; i < indent + startIndent; ++i)
+    return true;
+}
+
+// Writes the indentation of a DOM element
+static void PrintIndent(std::ostream &ss, int indent)
+{
+    for (int i = 0; i < indent; ++i)
         ss << "  ";
-    ss << "<" << tagName;
+}
+
+// Writes the start tag of a DOM element with all its attributes
+static void PrintStartTag(DOMElement *element, std::ostream &ss, int indent, cTranscodeBuffer &transcodeBuffer)
+{
+    PrintIndent(ss, indent);
+    ss << "<" << transcodeBuffer.Transcode(element->getTagName());
 
-    // Print attributes
     DOMNamedNodeMap *attributes = element->getAttributes();
     XMLSize_t numAttrs = attributes->getLength();
     for (XMLSize_t i = 0; i < numAttrs; ++i)
     {
         DOMNode *attr = attributes->item(i);
-        char *attrName = XMLString::transcode(attr->getNodeName());
-        char *attrValue = XMLString::transcode(attr->getNodeValue());
-        ss << " " << attrName << "=\"" << attrValue << "\"";
-        XMLString::release(&attrName);
-        XMLString::release(&attrValue);
+        ss << " " << transcodeBuffer.Transcode(attr->getNodeName());
+        ss << "=\"" << transcodeBuffer.Transcode(attr->getNodeValue()) << "\"";
     }
 
     ss << ">";
+}
+
+// Element of the DOM tree which is currently printed
+struct cOpenDOMElement
+{
+    DOMElement *element;
+    DOMNode *nextChild;
+    int indent;
+    bool hasElementChildren;
+};
+
+// Writes a DOM element and all its children. Iterates over the tree with an explicit stack, so deep trees do not
+// exhaust the call stack, and transcodes all strings into one buffer.
+void PrintDOMElement(DOMElement *element, std::ostream &ss, int indent = 0, int startIndent = 0)
+{
+    if (!element)
+        return;
+
+    cTranscodeBuffer transcodeBuffer;
+    std::vector<cOpenDOMElement> openElements;
 
-    // Print children elements
-    DOMNodeList *children = element->getChildNodes();
-    XMLSize_t numChildren = children->getLength();
-    bool hasElementChildren = false;
+    PrintStartTag(element, ss, indent + startIndent, transcodeBuffer);
+    openElements.push_back({element, element->getFirstChild(), indent + startIndent, false});
 
-    for (XMLSize_t i = 0; i < numChildren; ++i)
+    while (!openElements.empty())
     {
-        DOMNode *child = children->item(i);
+        cOpenDOMElement &current = openElements.back();
+        DOMNode *child = current.nextChild;
+
+        if (child == nullptr)
+        {
+            if (current.hasElementChildren)
+            {
+                ss << "\n";
+                PrintIndent(ss, current.indent);
+            }
+
+            ss << "</" << transcodeBuffer.Transcode(current.element->getTagName()) << ">";
+            openElements.pop_back();
+            continue;
+        }
+
+        current.nextChild = child->getNextSibling();
+
         if (child->getNodeType() == DOMNode::TEXT_NODE)
         {
-            char *textContent = XMLString::transcode(child->getNodeValue());
-            ss << textContent;
-            XMLString::release(&textContent);
+            ss << transcodeBuffer.Transcode(child->getNodeValue());
         }
         else if (child->getNodeType() == DOMNode::ELEMENT_NODE)
         {
-            hasElementChildren = true;
-            ss << std::endl;
-            PrintDOMElement(dynamic_cast<DOMElement *>(child), ss, indent + 1, startIndent);
-        }
-    }
-
-    if (hasElementChildren)
-    {
-        ss << std::endl;
-        for (int i = 0; i < indent + startIndent; ++i)
-            ss << "  ";
-    }
-
-    ss << "</" << tagName << ">";
-    XMLString::release(&tagName);
-}
+            current.hasElementChildren = true;
+            ss << "\n";
 
-bool IsWhitespaceOrEmpty(const std::string &line)
-{
-    return std::all_of(line.begin(), line.end(), [](unsigned char c) { return std::isspace(c); });
-}
+            DOMElement *childElement = dynamic_cast<DOMElement *>(child);
+            const int childIndent = current.indent + 1;
+            PrintStartTag(childElement, ss, childIndent, transcodeBuffer);
 
-void RemoveEmptyLines(std::stringstream &ss)
-{
-    std::string line;
-    std::stringstream tempStream;
-    while (std::getline(ss, line))
-    {
-        if (!IsWhitespaceOrEmpty(line))
-        {
-            tempStream << line << std::endl;
+            // Invalidates current
+            openElements.push_back({childElement, childElement->getFirstChild(), childIndent, false});
         }
     }
-    ss.str(tempStream.str());
 }
 
 // Writes the summary to text
-void WriteResults(const char *file, cResultContainer *ptrResultContainer)
+void WriteResults(const char *file, cResultContainer *ptrResultContainer, unsigned int threadCount)
 {
-    // TODO: Write TEXT here
+    if (threadCount == 0)
+        threadCount = GetDefaultWorkerCount();
+    const eExecutionPolicy policy = (threadCount > 1) ? eExecutionPolicy::PARALLEL : eExecutionPolicy::SEQUENTIAL;
+
+    // The report is streamed into the file while walking the results, so a larger buffer saves write calls
+    std::vector<char> fileBuffer(REPORT_FILE_BUFFER_SIZE);
     std::ofstream outFile;
+    outFile.rdbuf()->pubsetbuf(fileBuffer.data(), (std::streamsize)fileBuffer.size());
     outFile.open(file);
 
     if (!ptrResultContainer->HasCheckerBundles())
@@ -271,43 +334,42 @@ void WriteResults(const char *file, cResultContainer *ptrResultContainer)
 
     if (outFile.is_open())
     {
-        std::stringstream ss;
-        ss << BASIC_SEPARATOR_LINE;
-        ss << "QC4OpenX - Pooled results" << std::endl;
-        ss << BASIC_SEPARATOR_LINE;
-        ss << std::endl;
+        outFile << BASIC_SEPARATOR_LINE;
+        outFile << "QC4OpenX - Pooled results" << "\n";
+        outFile << BASIC_SEPARATOR_LINE;
+        outFile << "\n";
 
         if ((*bundles.begin())->GetInputFileName().size() > 0)
-            ss << "InputFile: " << (*bundles.begin())->GetInputFileName(false) << std::endl;
+            outFile << "InputFile: " << (*bundles.begin())->GetInputFileName(false) << "\n";
 
-        ss << std::endl;
+        outFile << "\n";
 
         // Loop over all checkers
         for (std::list<cCheckerBundle *>::const_iterator it_Bundle = bundles.begin(); it_Bundle != bundles.end();
              it_Bundle++)
         {
-            ss << BASIC_SEPARATOR_LINE;
-            ss << "    CheckerBundle:  " << (*it_Bundle)->GetBundleName() << "\n";
-            ss << "    Build date:     " << (*it_Bundle)->GetBuildDate() << "\n";
-            ss << "    Build version:  " << (*it_Bundle)->GetBuildVersion() << "\n";
-            ss << "    Description:    " << (*it_Bundle)->GetDescription() << "\n";
-            ss << "    Summary:        " << (*it_Bundle)->GetSummary() << "\n";
+            outFile << BASIC_SEPARATOR_LINE;
+            outFile << "    CheckerBundle:  " << (*it_Bundle)->GetBundleName() << "\n";
+            outFile << "    Build date:     " << (*it_Bundle)->GetBuildDate() << "\n";
+            outFile << "    Build version:  " << (*it_Bundle)->GetBuildVersion() << "\n";
+            outFile << "    Description:    " << (*it_Bundle)->GetDescription() << "\n";
+            outFile << "    Summary:        " << (*it_Bundle)->GetSummary() << "\n";
 
             if ((*it_Bundle)->HasParams())
             {
-                ss << "    Parameters:     ";
+                outFile << "    Parameters:     ";
 
                 std::vector<std::string> checkerBundleParams = (*it_Bundle)->GetParams();
                 std::vector<std::string>::const_iterator itParams = checkerBundleParams.begin();
 
-                ss << *itParams << " = " << (*it_Bundle)->GetParam(*itParams);
+                outFile << *itParams << " = " << (*it_Bundle)->GetParam(*itParams);
                 itParams++;
 
                 for (; itParams != checkerBundleParams.end(); itParams++)
                 {
-                    ss << "\n                    " << *itParams << " = " << (*it_Bundle)->GetParam(*itParams);
+                    outFile << "\n                    " << *itParams << " = " << (*it_Bundle)->GetParam(*itParams);
                 }
-                ss << "\n";
+                outFile << "\n";
             }
 
             checkers = (*it_Bundle)->GetCheckers();
@@ -318,87 +380,69 @@ void WriteResults(const char *file, cResultContainer *ptrResultContainer)
                  itChecker++)
             {
 
-                ss << "\n\n    Checker:        " << (*itChecker)->GetCheckerID();
-                ss << "\n    Description:    " << (*itChecker)->GetDescription();
-                ss << "\n    Status:         " << (*itChecker)->GetStatus();
-                ss << "\n    Summary:        " << (*itChecker)->GetSummary();
+                outFile << "\n\n    Checker:        " << (*itChecker)->GetCheckerID();
+                outFile << "\n    Description:    " << (*itChecker)->GetDescription();
+                outFile << "\n    Status:         " << (*itChecker)->GetStatus();
+                outFile << "\n    Summary:        " << (*itChecker)->GetSummary();
 
                 if ((*itChecker)->HasParams())
                 {
-                    ss << "\n    Parameters:     ";
+                    outFile << "\n    Parameters:     ";
 
                     std::vector<std::string> checkerParams = (*itChecker)->GetParams();
                     std::vector<std::string>::const_iterator itCheckerParams = checkerParams.begin();
 
-                    ss << *itCheckerParams << " = " << (*itChecker)->GetParam(*itCheckerParams);
+                    outFile << *itCheckerParams << " = " << (*itChecker)->GetParam(*itCheckerParams);
                     itCheckerParams++;
 
                     for (; itCheckerParams != checkerParams.end(); itCheckerParams++)
                     {
-                        ss << "\n                    " << *itCheckerParams << " = "
-                           << (*itChecker)->GetParam(*itCheckerParams);
+                        outFile << "\n                    " << *itCheckerParams << " = "
+                                << (*itChecker)->GetParam(*itCheckerParams);
                     }
                 }
 
-                // Get all issues from the current checker
+                // Get all issues from the current checker. They are rendered in chunks, which can be processed
+                // concurrently and are written in order, so the report does not depend on the thread count.
                 issues = (*itChecker)->GetIssues();
-                if (issues.size() > 0)
+                std::vector<cIssue *> checkerIssues(issues.begin(), issues.end());
+
+                const std::size_t issuesPerWave = ISSUES_PER_CHUNK * CHUNKS_PER_WAVE_AND_THREAD * threadCount;
+                for (std::size_t waveBegin = 0; waveBegin < checkerIssues.size(); waveBegin += issuesPerWave)
                 {
-                    for (std::list<cIssue *>::const_iterator it_Issue = issues.begin(); it_Issue != issues.end();
-                         it_Issue++)
+                    const std::size_t waveEnd = std::min(checkerIssues.size(), waveBegin + issuesPerWave);
+                    const std::size_t chunkCount = (waveEnd - waveBegin + ISSUES_PER_CHUNK - 1) / ISSUES_PER_CHUNK;
+                    std::vector<cRenderedIssues> chunks(chunkCount);
+
+                    ForEachIndex(
+                        chunks.size(),
+                        [&](std::size_t chunk) {
+                            const std::size_t chunkBegin = waveBegin + chunk * ISSUES_PER_CHUNK;
+                            RenderIssues(checkerIssues, chunkBegin, std::min(waveEnd, chunkBegin + ISSUES_PER_CHUNK),
+                                         &chunks[chunk]);
+                        },
+                        policy, threadCount);
+
+                    for (const cRenderedIssues &chunk : chunks)
                     {
-                        ss << "\n        " << mapIssueLevelToString[(*it_Issue)->GetIssueLevel()]
-                           << (*it_Issue)->GetDescription();
-
-                        if ((*it_Issue)->GetRuleUID() != "")
-                        {
-                            ss << "\n                       " << "ruleUID: " << (*it_Issue)->GetRuleUID();
-                        }
-
-                        PrintExtendedInformationIntoStream((*it_Issue), &ss);
-                        if ((*it_Issue)->GetRuleUID() != "")
-                        {
-                            eIssueLevel current_issue_level = (*it_Issue)->GetIssueLevel();
-                            if (current_issue_level == eIssueLevel::INFO_LVL)
-                            {
-                                info_rules.insert((*it_Issue)->GetRuleUID());
-                            }
-                            if (current_issue_level == eIssueLevel::WARNING_LVL)
-                            {
-                                warning_violated_rules.insert((*it_Issue)->GetRuleUID());
-                            }
-                            if (current_issue_level == eIssueLevel::ERROR_LVL)
-                            {
-                                error_violated_rules.insert((*it_Issue)->GetRuleUID());
-                            }
-                        }
-                        if ((*it_Issue)->HasDomainSpecificInfo())
-                        {
-                            std::list<cDomainSpecificInfo *> domainSpecificInfo = (*it_Issue)->GetDomainSpecificInfo();
-
-                            for (std::list<cDomainSpecificInfo *>::const_iterator itDom = domainSpecificInfo.begin();
-                                 itDom != domainSpecificInfo.end(); itDom++)
-                            {
-                                ss << "\n        Name:       " << (*itDom)->GetName() << "\n";
-                                std::stringstream dom_ss;
-                                PrintDOMElement((*itDom)->GetRoot(), dom_ss, 0, 10);
-                                RemoveEmptyLines(dom_ss);
-                                ss << dom_ss.str();
-                            }
-                        }
+                        outFile << chunk.text;
+                        info_rules.insert(chunk.infoRules.begin(), chunk.infoRules.end());
+                        warning_violated_rules.insert(chunk.warningRules.begin(), chunk.warningRules.end());
+                        error_violated_rules.insert(chunk.errorRules.begin(), chunk.errorRules.end());
                     }
                 }
+
                 // Get all rules covered by the current checker
                 rules = (*itChecker)->GetRules();
                 if (rules.size() > 0)
                 {
-                    ss << "\n\n        Addressed Rules:        ";
+                    outFile << "\n\n        Addressed Rules:        ";
                 }
                 for (std::list<cRule *>::const_iterator it_Rule = rules.begin(); it_Rule != rules.end(); it_Rule++)
                 {
                     if ((*it_Rule)->GetRuleUID() != "")
                     {
-                        ss << "\n        - rule:         " << (*it_Rule)->GetRuleUID();
+                        outFile << "\n        - rule:         " << (*it_Rule)->GetRuleUID();
                         addressed_rules.insert((*it_Rule)->GetRuleUID());
                     }
                 }
@@ -406,80 +450,149 @@ void WriteResults(const char *file, cResultContainer *ptrResultContainer)
                 metadata = (*itChecker)->GetMetadata();
                 if (metadata.size() > 0)
                 {
-                    ss << "\n\n        Metadata:        ";
+                    outFile << "\n\n        Metadata:        ";
                 }
                 for (std::list<cMetadata *>::const_iterator it_Meta = metadata.begin(); it_Meta != metadata.end();
                      it_Meta++)
                 {
 
-                    ss << "\n        ----------------";
-                    ss << "\n        - key:          " << (*it_Meta)->GetKey();
-                    ss << "\n        - value:        " << (*it_Meta)->GetValue();
-                    ss << "\n        - description:  " << (*it_Meta)->GetDescription();
-                    ss << "\n        ----------------";
+                    outFile << "\n        ----------------";
+                    outFile << "\n        - key:          " << (*it_Meta)->GetKey();
+                    outFile << "\n        - value:        " << (*it_Meta)->GetValue();
+                    outFile << "\n        - description:  " << (*it_Meta)->GetDescription();
+                    outFile << "\n        ----------------";
                 }
             }
 
-            ss << "\n" << BASIC_SEPARATOR_LINE << "\n";
+            outFile << "\n" << BASIC_SEPARATOR_LINE << "\n";
         }
 
-        ss << "Rules report \n\n";
+        outFile << "Rules report \n\n";
 
-        ss << "\nTotal number of addressed rules:   " << addressed_rules.size();
+        outFile << "\nTotal number of addressed rules:   " << addressed_rules.size();
         for (const auto &str : addressed_rules)
         {
-            ss << "\n\t-> Addressed RuleUID: " << str << "\n";
+            outFile << "\n\t-> Addressed RuleUID: " << str << "\n";
         }
 
         int total_number_of_rules_with_issues =
             info_rules.size() + warning_violated_rules.size() + error_violated_rules.size();
-        ss << "\nTotal number of rules with found issues:    " << total_number_of_rules_with_issues << "\n";
+        outFile << "\nTotal number of rules with found issues:    " << total_number_of_rules_with_issues << "\n";
 
-        ss << "\nRules for information:               " << info_rules.size();
+        outFile << "\nRules for information:               " << info_rules.size();
         for (const auto &str : info_rules)
         {
-            ss << "\n\t-> RuleUID with info: " << str;
+            outFile << "\n\t-> RuleUID with info: " << str;
         }
-        ss << "\nRules with warning issues:            " << warning_violated_rules.size();
+        outFile << "\nRules with warning issues:            " << warning_violated_rules.size();
         for (const auto &str : warning_violated_rules)
         {
-            ss << "\n\t-> RuleUID with warning issue: " << str;
+            outFile << "\n\t-> RuleUID with warning issue: " << str;
         }
-        ss << "\nRules with error issues:              " << error_violated_rules.size();
+        outFile << "\nRules with error issues:              " << error_violated_rules.size();
         for (const auto &str : error_violated_rules)
         {
-            ss << "\n\t-> RuleUID with error issue: " << str;
+            outFile << "\n\t-> RuleUID with error issue: " << str;
         }
 
-        ss << "\n" << BASIC_SEPARATOR_LINE << "\n";
-
-        ss << BASIC_SEPARATOR_LINE << "\n";
-
-        ss << "Note" << "\n\n";
-        ss << "Rule UID format:" << "\n";
-        ss << "    <emanating-entity>:<standard>:x.y.z:rule_set.for_rules.rule_name" << "\n\n";
-        ss << "where    " << "\n";
-        ss << "    Emanating Entity: a domain name for the entity (organization or company) that declares the rule UID"
-           << "\n";
-        ss << "    Standard: a short string that represents the standard or the domain to which the rule is applied"
-           << "\n";
-        ss << "    Definition Setting: the version of the standard or the domain to which the rule appears or is "
-              "applied for the first time"
-           << "\n";
-        ss << "    Rule Full Name: the full name of the rule, as dot separated, snake lower case string. " << "\n";
-        ss << "        The full name of a rule is composed by the rule set, a categorization for the rule, " << "\n";
-        ss << "        and the rule name, a unique string inside the categorization. " << "\n";
-        ss << "        The rule set can be nested (meaning that can be defined as an " << "\n";
-        ss << "        arbitrary sequence of dot separated names, while the name is the snake " << "\n";
-        ss << "        case string after the last dot of the full name)" << "\n";
-
-        ss << "\n" << BASIC_SEPARATOR_LINE << "\n";
-
-        outFile << ss.rdbuf();
+        outFile << "\n" << BASIC_SEPARATOR_LINE << "\n";
+
+        outFile << BASIC_SEPARATOR_LINE << "\n";
+
+        outFile << "Note" << "\n\n";
+        outFile << "Rule UID format:" << "\n";
+        outFile << "    <emanating-entity>:<standard>:x.y.z:rule_set.for_rules.rule_name" << "\n\n";
+        outFile << "where    " << "\n";
+        outFile << "    Emanating Entity: a domain name for the entity (organization or company) that declares the "
+                   "rule UID"
+                << "\n";
+        outFile << "    Standard: a short string that represents the standard or the domain to which the rule is "
+                   "applied"
+                << "\n";
+        outFile << "    Definition Setting: the version of the standard or the domain to which the rule appears or is "
+                   "applied for the first time"
+                << "\n";
+        outFile << "    Rule Full Name: the full name of the rule, as dot separated, snake lower case string. " << "\n";
+        outFile << "        The full name of a rule is composed by the rule set, a categorization for the rule, "
+                << "\n";
+        outFile << "        and the rule name, a unique string inside the categorization. " << "\n";
+        outFile << "        The rule set can be nested (meaning that can be defined as an " << "\n";
+        outFile << "        arbitrary sequence of dot separated names, while the name is the snake " << "\n";
+        outFile << "        case string after the last dot of the full name)" << "\n";
+
+        outFile << "\n" << BASIC_SEPARATOR_LINE << "\n";
+
         outFile.close();
     }
 }
 
+void RenderIssues(const std::vector<cIssue *> &issues, std::size_t begin, std::size_t end, cRenderedIssues *result)
+{
+    std::ostringstream stream;
+    for (std::size_t i = begin; i < end; i++)
+    {
+        cIssue *issue = issues[i];
+        PrintIssueIntoStream(issue, stream);
+
+        if (issue->GetRuleUID() != "")
+        {
+            eIssueLevel current_issue_level = issue->GetIssueLevel();
+            if (current_issue_level == eIssueLevel::INFO_LVL)
+            {
+                result->infoRules.insert(issue->GetRuleUID());
+            }
+            if (current_issue_level == eIssueLevel::WARNING_LVL)
+            {
+                result->warningRules.insert(issue->GetRuleUID());
+            }
+            if (current_issue_level == eIssueLevel::ERROR_LVL)
+            {
+                result->errorRules.insert(issue->GetRuleUID());
+            }
+        }
+    }
+    result->text = stream.str();
+}
+
+void PrintIssueIntoStream(cIssue *issue, std::ostream &stream)
+{
+    // Lookup without operator[], because issues are printed concurrently
+    std::map<eIssueLevel, std::string>::const_iterator itLevel = mapIssueLevelToString.find(issue->GetIssueLevel());
+    stream << "\n        " << ((itLevel != mapIssueLevelToString.end()) ? itLevel->second : "")
+           << issue->GetDescription();
+
+    if (issue->GetRuleUID() != "")
+    {
+        stream << "\n                       " << "ruleUID: " << issue->GetRuleUID();
+    }
+
+    PrintExtendedInformationIntoStream(issue, &stream);
+
+    if (issue->HasDomainSpecificInfo())
+    {
+        std::list<cDomainSpecificInfo *> domainSpecificInfo = issue->GetDomainSpecificInfo();
+
+        for (std::list<cDomainSpecificInfo *>::const_iterator itDom = domainSpecificInfo.begin();
+             itDom != domainSpecificInfo.end(); itDom++)
+        {
+            stream << "\n        Name:       " << (*itDom)->GetName() << "\n";
+
+            // The DOM is only created for printing, so the info keeps its compact fragment storage
+            DOMDocument *domDoc = (*itDom)->ParseFragment();
+            if (nullptr == domDoc)
+                continue;
+
+            // Empty lines of the domain specific info are dropped while writing
+            cEmptyLineFilterStreamBuf domFilter(stream.rdbuf());
+            std::ostream domStream(&domFilter);
+            PrintDOMElement(domDoc->getDocumentElement(), domStream, 0, 10);
+            domFilter.Finish();
+
+            domDoc->release();
+        }
+    }
+}
+
 void AddPrefixForDescriptionIssueProcessor(cChecker *, cIssue *issueToProcess)
 {
     std::stringstream ssDescription;
@@ -488,7 +601,7 @@ void AddPrefixForDescriptionIssueProcessor(cChecker *, cIssue *issueToProcess)
     issueToProcess->SetDescription(ssDescription.str());
 }
 
-void PrintExtendedInformationIntoStream(cIssue *issue, std::stringstream *ssStream)
+void PrintExtendedInformationIntoStream(cIssue *issue, std::ostream *ssStream)
 {
     for (const auto location : issue->GetLocationsContainer())
     {
@@ -552,6 +665,90 @@ void PrintExtendedInformationIntoStream(cIssue *issue, std::stringstream *ssStre
     }
 }
 
+void WriteSummaryResults(const char *file, cResultContainer *ptrResultContainer, eReportMode mode,
+                         unsigned int topRuleCount)
+{
+    std::ofstream outFile(file);
+    if (!outFile.is_open() || !ptrResultContainer->HasCheckerBundles())
+        return;
+
+    // All aggregates are computed in one pass over the issues
+    cReportSummary summary;
+    summary.Collect(ptrResultContainer);
+
+    std::list<cCheckerBundle *> bundles = ptrResultContainer->GetCheckerBundles();
+
+    outFile << BASIC_SEPARATOR_LINE;
+    outFile << "QC4OpenX - Pooled results summary" << "\n";
+    outFile << BASIC_SEPARATOR_LINE;
+    outFile << "\n";
+
+    if ((*bundles.begin())->GetInputFileName().size() > 0)
+        outFile << "InputFile: " << (*bundles.begin())->GetInputFileName(false) << "\n";
+
+    outFile << "\nTotal number of issues:     " << summary.GetIssueCount() << "\n\n";
+
+    if (mode == REPORT_MODE_SUMMARY)
+    {
+        outFile << BASIC_SEPARATOR_LINE;
+        outFile << "Issues per checker" << "\n";
+
+        for (cCheckerBundle *bundle : bundles)
+        {
+            outFile << "\n    CheckerBundle:  " << bundle->GetBundleName();
+            outFile << "\n                    ";
+            PrintIssueCountsIntoStream(bundle->GetIssueCounter(), outFile);
+
+            std::list<cChecker *> checkers = bundle->GetCheckers();
+            for (cChecker *checker : checkers)
+            {
+                outFile << "\n        Checker:        " << checker->GetCheckerID();
+                outFile << "\n                        ";
+                PrintIssueCountsIntoStream(checker->GetIssueCounter(), outFile);
+            }
+            outFile << "\n";
+        }
+
+        outFile << "\n" << BASIC_SEPARATOR_LINE;
+        outFile << "Issues per rule" << "\n\n";
+        outFile << "    Rules with issues:          " << summary.GetRuleCount() << "\n";
+        outFile << "    Issues without rule:        ";
+        PrintIssueCountsIntoStream(summary.GetIssuesWithoutRule(), outFile);
+        outFile << "\n\n";
+
+        outFile << "      Errors  Warnings      Info     Total  RuleUID" << "\n";
+        for (const tRuleCount &rule : summary.GetRules())
+        {
+            outFile << std::setw(12) << rule.second->GetCount(eIssueLevel::ERROR_LVL) << std::setw(10)
+                    << rule.second->GetCount(eIssueLevel::WARNING_LVL) << std::setw(10)
+                    << rule.second->GetCount(eIssueLevel::INFO_LVL) << std::setw(10) << rule.second->GetCount()
+                    << "  " << *rule.first << "\n";
+        }
+        outFile << "\n";
+    }
+
+    outFile << BASIC_SEPARATOR_LINE;
+    outFile << "Top " << topRuleCount << " rules by issue count" << "\n\n";
+
+    unsigned int rank = 1;
+    for (const tRuleCount &rule : summary.GetTopRules(topRuleCount))
+    {
+        outFile << std::setw(6) << rank++ << ". " << *rule.first << "\n";
+        outFile << "            ";
+        PrintIssueCountsIntoStream(*rule.second, outFile);
+        outFile << "\n";
+    }
+
+    outFile << "\n" << BASIC_SEPARATOR_LINE;
+}
+
+void PrintIssueCountsIntoStream(const cIssueCounter &counter, std::ostream &stream)
+{
+    stream << "Errors: " << counter.GetCount(eIssueLevel::ERROR_LVL)
+           << "  Warnings: " << counter.GetCount(eIssueLevel::WARNING_LVL)
+           << "  Info: " << counter.GetCount(eIssueLevel::INFO_LVL) << "  Total: " << counter.GetCount();
+}
+
 void WriteDefaultConfig()
 {
     cConfiguration defaultConfig;
@@ -559,13 +756,15 @@ void WriteDefaultConfig()
     cConfigurationReportModule *reportModuleConfig = defaultConfig.AddReportModule(REPORT_MODULE_NAME);
     reportModuleConfig->SetParam("strInputFile", "Result.xqar");
     reportModuleConfig->SetParam("strReportFile", "Report.txt");
+    reportModuleConfig->SetParam("iThreadCount", "0");
+    reportModuleConfig->SetParam("strReportMode", "full");
+    reportModuleConfig->SetParam("iTopRuleCount", "10");
 
     std::stringstream ssConfigFile;
     ssConfigFile << REPORT_MODULE_NAME << ".xml";
 
-    std::cout << std::endl;
-    std::cout << "Write default config: '" << ssConfigFile.str() << "'" << std::endl << std::endl;
+    LogInfo() << "\nWrite default config: '" << ssConfigFile.str() << "'\n";
     defaultConfig.WriteConfigurationToFile(ssConfigFile.str());
 
-    std::cout << "Finished." << std::endl;
+    LogInfo() << "Finished.";
 }
@@ -21,9 +21,16 @@
 
 #include "common/result_format/c_issue.h"
 
+#include <set>
+#include <string>
+#include <vector>
+
 #define REPORT_MODULE_NAME "TextReport"
 
 class cParameterContainer;
+class cResultContainer;
+class cChecker;
+class cIssueCounter;
 
 /**
  * Main function for application
@@ -46,8 +53,56 @@ void ShowHelp(const std::string &applicationName);
  */
 void RunTextReport(const cParameterContainer &inputParams);
 
+// Rendered text and rules with issues of a chunk of issues
+struct cRenderedIssues
+{
+    std::string text;
+    std::set<std::string> infoRules;
+    std::set<std::string> warningRules;
+    std::set<std::string> errorRules;
+};
+
+// Content of the text report
+enum eReportMode
+{
+    // Every issue with its locations and domain specific info
+    REPORT_MODE_FULL = 0,
+    // Issue counts per checker bundle, checker, rule UID and level plus the rules with most issues
+    REPORT_MODE_SUMMARY = 1,
+    // Only the rules with most issues
+    REPORT_MODE_TOP = 2
+};
+
+// Gets the report mode of the strReportMode parameter (full, summary or top). Returns false and leaves mode unchanged
+// for unknown strings.
+bool GetReportModeFromStr(const std::string &strMode, eReportMode *mode);
+
+// Writes the results to the hard dis drive. A threadCount of 0 uses all available cores.
+void WriteResults(const char *file, cResultContainer *ptrResultContainer, unsigned int threadCount = 0);
+
+/*
+ * Writes aggregated issue counts instead of the single issues
+ * \param file: Path of the report file
+ * \param ptrResultContainer: The results
+ * \param mode: REPORT_MODE_SUMMARY or REPORT_MODE_TOP
+ * \param topRuleCount: Count of rules in the list of rules with most issues
+ */
+void WriteSummaryResults(const char *file, cResultContainer *ptrResultContainer, eReportMode mode,
+                         unsigned int topRuleCount);
+
+// Writes the issue counts per level
+void PrintIssueCountsIntoStream(const cIssueCounter &counter, std::ostream &stream);
+
+// Renders the issues [begin, end) of a checker and collects their rules
+void RenderIssues(const std::vector<cIssue *> &issues, std::size_t begin, std::size_t end, cRenderedIssues *result);
+
+// Writes a single issue into the text report
+void PrintIssueIntoStream(cIssue *issue, std::ostream &stream);
+
+void AddPrefixForDescriptionIssueProcessor(cChecker *checker, cIssue *issueToProcess);
+
 // Prints Extended Informations into the text report
-void PrintExtendedInformationIntoStream(cIssue *item, std::stringstream *ssStream);
+void PrintExtendedInformationIntoStream(cIssue *item, std::ostream *ssStream);
 
 /**
  * Writes the default configuration for a report
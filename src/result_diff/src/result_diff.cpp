@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#include "result_diff.h"
+#include "common/c_logger.h"
+#include "common/result_format/c_checker.h"
+#include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_issue_baseline.h"
+#include "common/result_format/c_issue_fingerprint.h"
+#include "stdafx.h"
+
+XERCES_CPP_NAMESPACE_USE
+
+const char BASIC_SEPARATOR_LINE[] =
+    "====================================================================================================\n";
+
+// Main Programm
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> args(argv, argv + argc);
+    std::string strToolpath = args[0];
+
+    if (args.size() == 2 && (args[1] == "-h" || args[1] == "--help"))
+    {
+        ShowHelp(strToolpath);
+        return 0;
+    }
+
+    if (args.size() == 4 && args[1] == "--write_baseline")
+        return WriteBaseline(args[2], args[3]);
+
+    if (args.size() != 3 && args.size() != 4)
+    {
+        LogError() << "Invalid number of arguments.";
+        ShowHelp(strToolpath);
+        return 1;
+    }
+
+    const std::string strBaseFile = args[1];
+    const std::string strCurrentFile = args[2];
+    const std::string strOutputFile = (args.size() == 4) ? args[3] : "Diff.xqar";
+
+    for (const std::string &strFile : {strBaseFile, strCurrentFile})
+    {
+        if (!fs::exists(strFile))
+        {
+            LogError() << "Result file '" << strFile << "' does not exist!";
+            return 1;
+        }
+    }
+
+    XMLPlatformUtils::Initialize();
+
+    int result = 0;
+    {
+        cResultContainer baseResults;
+        cResultContainer currentResults;
+
+        try
+        {
+            LogInfo() << "Read base results: '" << strBaseFile << "' ...";
+            baseResults.AddResultsFromXML(strBaseFile);
+
+            LogInfo() << "Read current results: '" << strCurrentFile << "' ...\n";
+            currentResults.AddResultsFromXML(strCurrentFile);
+
+            cResultDiff diff;
+            diff.Compare(baseResults, currentResults);
+
+            LogInfo() << "Added:     " << diff.GetAdded().size();
+            LogInfo() << "Removed:   " << diff.GetRemoved().size();
+            LogInfo() << "Unchanged: " << diff.GetUnchanged().size() << "\n";
+
+            LogInfo() << "Write diff: '" << strOutputFile << "'\n";
+            if (StringEndsWith(ToLower(strOutputFile), ".xqar"))
+                WriteDiffAsXQAR(diff, baseResults, currentResults, strOutputFile);
+            else
+                WriteDiffAsText(diff, strBaseFile, strCurrentFile, strOutputFile);
+
+            LogInfo() << "Finished.";
+        }
+        catch (const std::exception &e)
+        {
+            LogError() << "Could not compare results: " << e.what();
+            result = 1;
+        }
+    }
+
+    cLogger::GetInstance().WriteSummary();
+
+    XMLPlatformUtils::Terminate();
+
+    return result;
+}
+
+void ShowHelp(const std::string &toolPath)
+{
+    std::string applicationName = toolPath;
+    std::string applicationNameWithoutExt = toolPath;
+    GetFileName(&applicationName, false);
+    GetFileName(&applicationNameWithoutExt, true);
+
+    std::cout << "\n\nUsage of " << applicationNameWithoutExt << ":" << std::endl;
+    std::cout << "\nCompare two result files and write the added issues to Diff.xqar and the removed issues to "
+                 "Diff_removed.xqar: \n"
+              << applicationName << " base.xqar current.xqar" << std::endl;
+    std::cout << "\nCompare two result files and write the added and removed issues to given xqar files: \n"
+              << applicationName << " base.xqar current.xqar myDiff.xqar" << std::endl;
+    std::cout << "\nCompare two result files and write the added and removed issues as text report: \n"
+              << applicationName << " base.xqar current.xqar myDiff.txt" << std::endl;
+    std::cout << "\nWrite the fingerprints of all issues of a result file as baseline for the ResultPooling: \n"
+              << applicationName << " --write_baseline Result.xqar baseline.txt" << std::endl;
+    std::cout << "\n\n";
+}
+
+int WriteBaseline(const std::string &strResultFile, const std::string &strBaselineFile)
+{
+    if (!fs::exists(strResultFile))
+    {
+        LogError() << "Result file '" << strResultFile << "' does not exist!";
+        cLogger::GetInstance().WriteSummary();
+        return 1;
+    }
+
+    XMLPlatformUtils::Initialize();
+
+    bool success = false;
+    {
+        cResultContainer results;
+
+        LogInfo() << "Read results: '" << strResultFile << "' ...\n";
+        results.AddResultsFromXML(strResultFile);
+
+        cIssueBaseline baseline;
+        for (uint64_t fingerprint : cResultDiff::ComputeFingerprints(results.Query(cResultQuery())))
+            baseline.Add(fingerprint);
+
+        LogInfo() << "Write baseline with " << baseline.GetCount() << " fingerprints: '" << strBaselineFile << "'";
+        success = baseline.WriteToFile(strBaselineFile);
+    }
+
+    cLogger::GetInstance().WriteSummary();
+
+    XMLPlatformUtils::Terminate();
+
+    return success ? 0 : 1;
+}
+
+void WriteDiffAsXQAR(const cResultDiff &diff, cResultContainer &baseResults, cResultContainer &currentResults,
+                     const std::string &strOutputFile)
+{
+    std::string strRemovedFile = strOutputFile;
+    strRemovedFile.insert(strRemovedFile.size() - std::string(".xqar").size(), "_removed");
+
+    // Disabled issues are not serialized, so only keep the issues of the diff enabled
+    for (cIssue *issue : currentResults.GetIssues())
+        issue->SetEnabled(false);
+    for (const cIssueHandle &handle : diff.GetAdded())
+        handle.issue->SetEnabled(true);
+
+    currentResults.WriteResults(strOutputFile);
+
+    for (cIssue *issue : baseResults.GetIssues())
+        issue->SetEnabled(false);
+    for (const cIssueHandle &handle : diff.GetRemoved())
+        handle.issue->SetEnabled(true);
+
+    LogInfo() << "Write removed issues: '" << strRemovedFile << "'\n";
+    baseResults.WriteResults(strRemovedFile);
+}
+
+void WriteDiffAsText(const cResultDiff &diff, const std::string &strBaseFile, const std::string &strCurrentFile,
+                     const std::string &strOutputFile)
+{
+    std::ofstream outFile(strOutputFile);
+    if (!outFile.is_open())
+    {
+        LogError() << "Could not open file '" << strOutputFile << "'!";
+        return;
+    }
+
+    outFile << BASIC_SEPARATOR_LINE;
+    outFile << "QC4OpenX - Result Diff\n";
+    outFile << BASIC_SEPARATOR_LINE << "\n";
+    outFile << "Base:      " << strBaseFile << "\n";
+    outFile << "Current:   " << strCurrentFile << "\n\n";
+    outFile << "Added:     " << diff.GetAdded().size() << "\n";
+    outFile << "Removed:   " << diff.GetRemoved().size() << "\n";
+    outFile << "Unchanged: " << diff.GetUnchanged().size() << "\n\n";
+
+    outFile << "Added issues:\n";
+    PrintIssues(diff.GetAdded(), outFile);
+
+    outFile << "\nRemoved issues:\n";
+    PrintIssues(diff.GetRemoved(), outFile);
+}
+
+void PrintIssues(const std::vector<cIssueHandle> &issues, std::ostream &stream)
+{
+    for (const cIssueHandle &handle : issues)
+    {
+        stream << "    " << cIssueFingerprint::ToString(
+                                cIssueFingerprint::Compute(handle.bundle, handle.checker, handle.issue))
+               << "  " << handle.issue->GetIssueLevelStr() << "  " << handle.bundle->GetBundleName() << " / "
+               << handle.checker->GetCheckerID() << "  " << handle.issue->GetRuleUID() << "\n        "
+               << handle.issue->GetDescription() << "\n";
+    }
+}
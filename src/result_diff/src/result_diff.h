@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "common/qc4openx_filesystem.h"
+#include "common/result_format/c_result_container.h"
+#include "common/result_format/c_result_diff.h"
+#include "common/util.h"
+
+#define CHECKER_BUNDLE_NAME "ResultDiff"
+
+/**
+ * Main function for application
+ *
+ * @param    [in] argc                Number of arguments in shell
+ * @param    [in] argv                Pointer to arguments
+ *
+ * @return   The standard return value
+ */
+int main(int argc, char *argv[]);
+
+/**
+ * Shows the help for the application
+ * @param    [in] applicationName    The name of the application
+ */
+void ShowHelp(const std::string &applicationName);
+
+/**
+ * Writes the fingerprints of all issues of a result file as baseline file
+ *
+ * @param    [in] strResultFile      Path of the result file
+ * @param    [in] strBaselineFile    Path of the baseline file
+ *
+ * @return   0 on success, else 1
+ */
+int WriteBaseline(const std::string &strResultFile, const std::string &strBaselineFile);
+
+/**
+ * Writes the added issues of the current results and the removed issues of the base results as xqar files.
+ * Both containers are changed: all issues which are not part of the output are disabled.
+ *
+ * @param    [in] diff               The diff of both containers
+ * @param    [in] baseResults        Results of the reference run
+ * @param    [in] currentResults     Results of the run to compare
+ * @param    [in] strOutputFile      File for the added issues. Removed issues are written to <name>_removed.xqar
+ */
+void WriteDiffAsXQAR(const cResultDiff &diff, cResultContainer &baseResults, cResultContainer &currentResults,
+                     const std::string &strOutputFile);
+
+/**
+ * Writes the added and removed issues as text report
+ *
+ * @param    [in] diff               The diff of both containers
+ * @param    [in] strBaseFile        Path of the base results
+ * @param    [in] strCurrentFile     Path of the current results
+ * @param    [in] strOutputFile      Path of the report
+ */
+void WriteDiffAsText(const cResultDiff &diff, const std::string &strBaseFile, const std::string &strCurrentFile,
+                     const std::string &strOutputFile);
+
+/**
+ * Writes one line per issue into a stream
+ *
+ * @param    [in] issues             The issues to print
+ * @param    [in] stream             The target stream
+ */
+void PrintIssues(const std::vector<cIssueHandle> &issues, std::ostream &stream);
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: MPL-2.0
+/**
+ * Copyright 2024, ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+#ifndef _STD_INCLUDES_HEADER_RESULT_DIFF_
+#define _STD_INCLUDES_HEADER_RESULT_DIFF_
+
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <sstream>
+
+#include "common/util.h"
+
+#endif // _STD_INCLUDES_HEADER_RESULT_DIFF_
@@ -8,12 +8,14 @@
  * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 #include "result_pooling.h"
+#include "common/c_logger.h"
 #include "common/config_format/c_configuration.h"
 #include "common/config_format/c_configuration_checker.h"
 #include "common/config_format/c_configuration_checker_bundle.h"
 #include "common/result_format/c_checker_bundle.h"
 #include "common/result_format/c_file_location.h"
 #include "common/result_format/c_inertial_location.h"
+#include "common/result_format/c_issue_baseline.h"
 #include "common/result_format/c_issue.h"
 #include "common/result_format/c_locations_container.h"
 #include "common/result_format/c_parameter_container.h"
@@ -50,6 +52,37 @@ int main(int argc, char *argv[])
     std::vector<std::string> args(argv, argv + argc);
     std::string strToolpath = args[0];
 
+    cParameterContainer inputParams;
+
+    // Extract the optional baseline arguments, the remaining arguments are positional
+    for (std::size_t i = 1; i < args.size();)
+    {
+        if (args[i] == "--baseline" || args[i] == "--baseline_mode")
+        {
+            if (i + 1 >= args.size() || args[i + 1].compare(0, 2, "--") == 0)
+            {
+                LogError() << "Missing value for argument " << args[i] << ".";
+                ShowHelp(strToolpath);
+                return 1;
+            }
+            inputParams.SetParam((args[i] == "--baseline") ? "strBaselineFile" : "strBaselineMode", args[i + 1]);
+            args.erase(args.begin() + i, args.begin() + i + 2);
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    eBaselineMode baselineMode;
+    if (inputParams.HasParam("strBaselineMode") &&
+        !cIssueBaseline::GetModeFromStr(inputParams.GetParam("strBaselineMode"), &baselineMode))
+    {
+        LogError() << "Invalid baseline mode: " << inputParams.GetParam("strBaselineMode") << ".";
+        ShowHelp(strToolpath);
+        return 1;
+    }
+
     bool config_file_set = false;
     bool result_dir_set = false;
     std::string config_file;
@@ -58,7 +91,7 @@ int main(int argc, char *argv[])
     if (args.size() == 1)
     {
         // No arguments provided other than the program name
-        std::cout << "No arguments provided.\n";
+        LogInfo() << "No arguments provided.";
     }
     else if (args.size() == 2)
     {
@@ -81,7 +114,7 @@ int main(int argc, char *argv[])
         }
         else
         {
-            std::cerr << "Invalid argument: " << arg << "\n";
+            LogError() << "Invalid argument: " << arg;
             return 1; // Return error code
         }
     }
@@ -93,8 +126,8 @@ int main(int argc, char *argv[])
 
         if (isDirectory(arg1) && isXmlFile(arg2))
         {
-            std::cout << "Results directory: " << arg1 << "\n";
-            std::cout << "Configuration file: " << arg2 << "\n";
+            LogInfo() << "Results directory: " << arg1;
+            LogInfo() << "Configuration file: " << arg2;
             result_dir = arg1;
             config_file = arg2;
             config_file_set = true;
@@ -102,19 +135,17 @@ int main(int argc, char *argv[])
         }
         else
         {
-            std::cerr << "Invalid arguments: " << arg1 << " must be a directory and " << arg2
-                      << "must be an xml file \n";
+            LogError() << "Invalid arguments: " << arg1 << " must be a directory and " << arg2
+                       << "must be an xml file ";
             return 1; // Return error code
         }
     }
     else
     {
-        std::cerr << "Invalid number of arguments.\n";
+        LogError() << "Invalid number of arguments.";
         return 1; // Return error code
     }
 
-    cParameterContainer inputParams;
-
     // Default parameters
     inputParams.SetParam("strResultFile", "Result.xqar");
     fs::path resultsDirectory = GetWorkingDir();
@@ -133,27 +164,29 @@ int main(int argc, char *argv[])
             else
                 resultsDirectory = resultsDirectory.append(result_dir);
         }
-        std::cout << "resultsDirectory: " << resultsDirectory << std::endl;
+        LogInfo() << "resultsDirectory: " << resultsDirectory;
         if (!exists(resultsDirectory))
         {
-            std::cerr << "Directory '" << resultsDirectory << "' does not exist!" << std::endl
-                      << "Abort generating report!" << std::endl;
+            LogError() << "Directory '" << resultsDirectory << "' does not exist!\nAbort generating report!";
             return -1;
         }
     }
 
+    bool success = false;
     if (config_file_set)
     {
-        RunResultPoolingWithConfig(inputParams, resultsDirectory, config_file);
+        success = RunResultPoolingWithConfig(inputParams, resultsDirectory, config_file);
     }
     else
     {
-        RunResultPooling(inputParams, resultsDirectory);
+        success = RunResultPooling(inputParams, resultsDirectory);
     }
 
+    cLogger::GetInstance().WriteSummary();
+
     XMLPlatformUtils::Terminate();
 
-    return 0;
+    return success ? 0 : 1;
 }
 
 void ShowHelp(const std::string &toolPath)
@@ -172,31 +205,38 @@ void ShowHelp(const std::string &toolPath)
               << applicationName << " config.xml " << std::endl;
     std::cout << "\nRun the application to summarize all xqar files from a specified directory with given config: \n"
               << applicationName << " ../results/ config.xml " << std::endl;
+    std::cout << "\nSuppress the accepted issues listed in a baseline file (see ResultDiff): \n"
+              << applicationName << " ../results/ config.xml --baseline baseline.txt [--baseline_mode drop|disable]"
+              << std::endl;
+    std::cout << "\nWith drop (default) the accepted issues are removed. With disable they are disabled instead. "
+                 "Disabled issues are not written to the pooled result file either, so both modes produce the same "
+                 "file and only differ in the issue counts logged while pooling."
+              << std::endl;
     std::cout << "\n\n";
 }
 
-void RunResultPooling(const cParameterContainer &inputParams, const fs::path &resultsDirectory)
+bool RunResultPooling(const cParameterContainer &inputParams, const fs::path &resultsDirectory)
 {
     std::string strResultFile = inputParams.GetParam("strResultFile");
 
-    pResultContainer = new cResultContainer();
+    cIssueBaseline baseline;
+    if (!LoadBaseline(inputParams, &baseline))
+        return false;
 
-    std::cout << std::endl;
+    pResultContainer = new cResultContainer();
+    pResultContainer->SetBaseline(&baseline);
 
     // Delete old result file in working directory
-    std::cout << "Cleanup: ";
     if (fs::exists(strResultFile))
     {
-        std::cout << "Delete: " << std::endl;
-        std::cout << ">  " << strResultFile;
+        LogInfo() << "\nCleanup: Delete: \n>  " << strResultFile;
 
         QFile file(strResultFile.c_str());
         file.remove();
     }
-    std::cout << std::endl << std::endl;
-    std::cout << "Collect results from directory: " << std::endl << resultsDirectory << std::endl << std::endl;
+    LogInfo() << "\nCollect results from directory: \n" << resultsDirectory << "\n";
 
-    std::cout << "Found: " << std::endl;
+    LogInfo() << "Found: ";
     for (auto &pFilePath : fs::directory_iterator(resultsDirectory))
     {
         std::string strFilePath = pFilePath.path().string();
@@ -209,57 +249,58 @@ void RunResultPooling(const cParameterContainer &inputParams, const fs::path &re
 
         if (StringEndsWith(strFileName, "xqar"))
         {
-            std::cout << ">  " << strFileName << "\t\tReading..." << std::endl;
+            LogInfo() << ">  " << strFileName << "\t\tReading...";
             pResultContainer->AddResultsFromXML(strFilePath);
         }
     }
 
-    std::cout << std::endl << "Find locations in xml file..." << std::endl << std::endl;
+    if (baseline.GetCount() > 0)
+        LogInfo() << "\nSuppressed " << baseline.GetSuppressedCount() << " issues by baseline.";
+
+    LogInfo() << "\nFind locations in xml file...\n";
 
     AddFileLocationsToIssues();
 
-    std::cout << "Write report: '" << strResultFile << "'" << std::endl << std::endl;
+    LogInfo() << "Write report: '" << strResultFile << "'\n";
     pResultContainer->WriteResults(strResultFile);
 
-    std::cout << "Finished." << std::endl;
+    LogInfo() << "Finished.";
 
     delete pResultContainer;
+    return true;
 }
 
-void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path &resultsDirectory,
+bool RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path &resultsDirectory,
                                 const std::string &configFile)
 {
     cConfiguration configuration;
 
-    std::cout << "Config: " << configFile << std::endl;
+    LogInfo() << "Config: " << configFile;
     if (!cConfiguration::ParseFromXML(&configuration, configFile))
     {
-        std::cerr << "Could not read configuration! Abort." << std::endl;
-        return;
+        LogError() << "Could not read configuration! Abort.";
+        return false;
     }
 
     std::string strResultFile = inputParams.GetParam("strResultFile");
 
-    pResultContainer = new cResultContainer();
+    cIssueBaseline baseline;
+    if (!LoadBaseline(inputParams, &baseline))
+        return false;
 
-    std::cout << std::endl;
+    pResultContainer = new cResultContainer();
+    pResultContainer->SetBaseline(&baseline);
 
     // Delete old result file in working directory
-    std::cout << "Cleanup: ";
     if (fs::exists(strResultFile))
     {
-        std::cout << "Delete: " << std::endl;
-        std::cout << ">  " << strResultFile;
+        LogInfo() << "\nCleanup: Delete: \n>  " << strResultFile;
 
         QFile file(strResultFile.c_str());
         file.remove();
     }
-    std::cout << std::endl << std::endl;
-    std::cout << "Collect results from directory: " << std::endl
-              << "> " << resultsDirectory << std::endl
-              << "According to config file: " << std::endl
-              << "> " << configFile << std::endl
-              << std::endl;
+    LogInfo() << "\nCollect results from directory: \n> " << resultsDirectory << "\nAccording to config file: \n> "
+              << configFile << "\n";
 
     fs::path result_path = resultsDirectory;
 
@@ -279,7 +320,7 @@ void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path
 
         if (!fs::exists(full_path))
         {
-            std::cerr << "Result file " << full_path << "not found. Skipping pooling step..." << std::endl;
+            LogWarning() << "Result file " << full_path << "not found. Skipping pooling step...";
             continue;
         }
 
@@ -303,8 +344,7 @@ void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path
 
             if (itCheckerBundle == nullptr)
             {
-                std::cerr << "Checker Bundle " << config_checker_bundle_name << " not found in result. Skipping ..."
-                          << std::endl;
+                LogWarning() << "Checker Bundle " << config_checker_bundle_name << " not found in result. Skipping ...";
                 break;
             }
 
@@ -319,8 +359,8 @@ void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path
 
             if (itChecker == nullptr)
             {
-                std::cerr << "Checker  " << config_checker_id << " not found among result checker bundle. Skipping ..."
-                          << std::endl;
+                LogWarning() << "Checker  " << config_checker_id
+                             << " not found among result checker bundle. Skipping ...";
                 break;
             }
             unsigned int pre_size = itChecker->GetIssueCount();
@@ -328,10 +368,9 @@ void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path
             unsigned int post_size = itChecker->GetIssueCount();
             if ((pre_size - post_size) > 0)
             {
-                std::cout << "Filtering checker " << config_checker_id << " results. " << std::endl
-                          << "Keeping issues between level " << config_min_level << " and " << config_max_level
-                          << std::endl;
-                std::cout << "Filtered " << (pre_size - post_size) << " issues " << std::endl << std::endl;
+                LogInfo() << "Filtering checker " << config_checker_id << " results. \nKeeping issues between level "
+                          << config_min_level << " and " << config_max_level;
+                LogInfo() << "Filtered " << (pre_size - post_size) << " issues \n";
             }
         }
     }
@@ -359,16 +398,20 @@ void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path
         }
     }
 
-    std::cout << std::endl << "Find locations in xml file..." << std::endl << std::endl;
+    if (baseline.GetCount() > 0)
+        LogInfo() << "\nSuppressed " << baseline.GetSuppressedCount() << " issues by baseline.";
+
+    LogInfo() << "\nFind locations in xml file...\n";
 
     AddFileLocationsToIssues();
 
-    std::cout << "Write report: '" << strResultFile << "'" << std::endl << std::endl;
+    LogInfo() << "Write report: '" << strResultFile << "'\n";
     pResultContainer->WriteResults(strResultFile);
 
-    std::cout << "Finished." << std::endl;
+    LogInfo() << "Finished.";
 
     delete pResultContainer;
+    return true;
 }
 
 static void AddFileLocationsToIssues()
@@ -390,6 +433,10 @@ static void AddFileLocationsToIssues()
         std::list<cIssue *> issues = itCheckerBundle->GetIssues();
         for (const auto &itIssue : issues)
         {
+            // Disabled issues are not written to the result file
+            if (!itIssue->IsEnabled())
+                continue;
+
             for (const auto location : itIssue->GetLocationsContainer())
             {
                 // Check for xml Location
@@ -414,9 +461,8 @@ static void AddFileLocationsToIssues()
                         }
 
                         if (!successGetRows)
-                            std::cerr << "Could not calculate file location for current issue (xpath: '" << xpath
-                                      << "')." << std::endl
-                                      << std::endl;
+                            LogWarning("Unresolved xpath")
+                                << "Could not calculate file location for current issue (xpath: '" << xpath << "').";
                     }
                 }
             }
@@ -424,6 +470,31 @@ static void AddFileLocationsToIssues()
     }
 }
 
+bool LoadBaseline(const cParameterContainer &inputParams, cIssueBaseline *baseline)
+{
+    std::string strBaselineFile = inputParams.GetParam("strBaselineFile");
+    if (strBaselineFile.empty())
+        return true;
+
+    eBaselineMode mode;
+    if (!cIssueBaseline::GetModeFromStr(inputParams.GetParam("strBaselineMode", "drop"), &mode))
+    {
+        LogError() << "Invalid baseline mode: " << inputParams.GetParam("strBaselineMode") << ". Abort.";
+        return false;
+    }
+    baseline->SetMode(mode);
+
+    LogInfo() << "Baseline: " << strBaselineFile;
+    if (!baseline->LoadFromFile(strBaselineFile))
+    {
+        LogError() << "Could not read baseline! Abort.";
+        return false;
+    }
+
+    LogInfo() << "Loaded " << baseline->GetCount() << " fingerprints of accepted issues.";
+    return true;
+}
+
 const fs::path GetWorkingDir()
 {
     return fs::current_path();
@@ -16,6 +16,7 @@
 #define CHECKER_BUNDLE_NAME "ResultPooling"
 
 class cParameterContainer;
+class cIssueBaseline;
 
 /**
  * Main function for application
@@ -35,13 +36,17 @@ void ShowHelp(const std::string &applicationName);
 
 /**
  * Runs the result pooling
+ *
+ * @return   False if the pooling was aborted
  */
-void RunResultPooling(const cParameterContainer &inputParams, const fs::path &pathToResults);
+bool RunResultPooling(const cParameterContainer &inputParams, const fs::path &pathToResults);
 
 /**
  * Runs the result pooling with given config file
+ *
+ * @return   False if the pooling was aborted
  */
-void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path &pathToResults,
+bool RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path &pathToResults,
                                 const std::string &configFile);
 
 /*!
@@ -51,6 +56,16 @@ void RunResultPoolingWithConfig(cParameterContainer &inputParams, const fs::path
  */
 static void AddFileLocationsToIssues();
 
+/**
+ * Loads the baseline file given by the parameter strBaselineFile. Does nothing if no baseline file is set.
+ *
+ * @param    [in] inputParams        The parameters of the pooling
+ * @param    [out] baseline          The baseline to fill
+ *
+ * @return   false if the baseline file could not be read
+ */
+bool LoadBaseline(const cParameterContainer &inputParams, cIssueBaseline *baseline);
+
 /**
  * Get working directory
  *
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024 ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "gtest/gtest.h"
+
+#include "helper.h"
+
+#include <fstream>
+#include <vector>
+
+#define MODULE_NAME "GithubCIReport"
+
+class cTesterReportModuleGithubCI : public ::testing::Test
+{
+  public:
+    std::string strTestFilesDir = std::string(QC4OPENX_DBQA_REPORT_MODULE_GITHUB_CI_TEST_REF_DIR);
+    std::string strWorkingDir = std::string(QC4OPENX_DBQA_REPORT_MODULE_GITHUB_CI_TEST_WORK_DIR);
+
+    // Returns the annotation lines of a captured output
+    std::vector<std::string> ReadAnnotations(const std::string &strOutputFilePath)
+    {
+        std::vector<std::string> annotations;
+
+        std::ifstream outputFile(strOutputFilePath);
+        std::string strLine;
+        while (std::getline(outputFile, strLine))
+        {
+            if (strLine.compare(0, 2, "::") == 0)
+                annotations.push_back(strLine);
+        }
+        return annotations;
+    }
+};
+
+TEST_F(cTesterReportModuleGithubCI, CmdBasic)
+{
+    std::string strResultMessage;
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+}
+
+TEST_F(cTesterReportModuleGithubCI, CmdXqarFileNotFound)
+{
+    std::string strResultMessage;
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, "error.xqar");
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+}
+
+TEST_F(cTesterReportModuleGithubCI, CmdConfigFull)
+{
+    std::string strResultMessage;
+
+    std::string strConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_full_config.xml";
+    std::string strOutputFilePath = strWorkingDir + "/" + "GithubCIReport_full.txt";
+
+    // The result contains an error, which fails the pipeline
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strConfigFilePath + " > " + strOutputFilePath);
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+
+    std::vector<std::string> annotations = ReadAnnotations(strOutputFilePath);
+    ASSERT_TRUE_EXT(annotations.size() == 5, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(annotations[3].compare(0, 9, "::error::") == 0, strResultMessage.c_str());
+
+    nRes = CheckFileExists(strResultMessage, strOutputFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+}
+
+TEST_F(cTesterReportModuleGithubCI, CmdConfigStream)
+{
+    std::string strResultMessage;
+
+    std::string strFullConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_full_config.xml";
+    std::string strStreamConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_stream_config.xml";
+    std::string strFullOutputFilePath = strWorkingDir + "/" + "GithubCIReport_full.txt";
+    std::string strStreamOutputFilePath = strWorkingDir + "/" + "GithubCIReport_stream.txt";
+
+    TestResult nRes =
+        ExecuteCommand(strResultMessage, MODULE_NAME, strFullConfigFilePath + " > " + strFullOutputFilePath);
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+
+    nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strStreamConfigFilePath + " > " + strStreamOutputFilePath);
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+
+    // Both read modes write the same annotations with the same issue numbers
+    std::vector<std::string> fullAnnotations = ReadAnnotations(strFullOutputFilePath);
+    std::vector<std::string> streamAnnotations = ReadAnnotations(strStreamOutputFilePath);
+    ASSERT_TRUE_EXT(fullAnnotations.size() == 5, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(fullAnnotations == streamAnnotations, strResultMessage.c_str());
+
+    fs::remove(strFullOutputFilePath.c_str());
+    fs::remove(strStreamOutputFilePath.c_str());
+}
+
+TEST_F(cTesterReportModuleGithubCI, CmdConfigMaxAnnotations)
+{
+    std::string strResultMessage;
+
+    std::string strConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_max_annotations_config.xml";
+    std::string strOutputFilePath = strWorkingDir + "/" + "GithubCIReport_max_annotations.txt";
+
+    // The error is not annotated anymore, but still fails the pipeline
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strConfigFilePath + " > " + strOutputFilePath);
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+
+    std::vector<std::string> annotations = ReadAnnotations(strOutputFilePath);
+    ASSERT_TRUE_EXT(annotations.size() == 3, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(annotations[2] == "::notice::Only the first 2 issues are annotated", strResultMessage.c_str());
+
+    nRes = CheckFileExists(strResultMessage, strOutputFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+}
+
+TEST_F(cTesterReportModuleGithubCI, CmdConfigStopAfterErrors)
+{
+    std::string strResultMessage;
+
+    std::string strConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_stop_after_errors_config.xml";
+    std::string strOutputFilePath = strWorkingDir + "/" + "GithubCIReport_stop_after_errors.txt";
+
+    // Reading stops at the first error, which still fails the pipeline
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strConfigFilePath + " > " + strOutputFilePath);
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+
+    // The information after the error is not annotated anymore
+    std::vector<std::string> annotations = ReadAnnotations(strOutputFilePath);
+    ASSERT_TRUE_EXT(annotations.size() == 4, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(annotations.back().compare(0, 9, "::error::") == 0, strResultMessage.c_str());
+
+    nRes = CheckFileExists(strResultMessage, strOutputFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+}
@@ -9,12 +9,40 @@
  */
 #include "gtest/gtest.h"
 
+#include "c_issue_density_index.h"
+#include "c_issue_filter.h"
+#include "c_issue_search_index.h"
+#include "c_viewer_issue_records.h"
+#include "common/result_format/c_checker_bundle.h"
+#include "common/result_format/c_file_location.h"
+#include "common/result_format/c_inertial_location.h"
+#include "common/result_format/c_issue.h"
+#include "common/result_format/c_locations_container.h"
+#include "common/result_format/c_result_container.h"
+#include "common/result_format/c_result_diff.h"
+#include "common/result_format/c_time_location.h"
+#include "common/result_format/c_xml_location.h"
 #include "helper.h"
 
+#include <algorithm>
+#include <atomic>
+
 #define MODULE_NAME "ReportGUI"
 
 class cTesterReportModuleGui : public ::testing::Test
 {
+  public:
+    // Returns the indices of the set bits
+    static std::vector<std::size_t> GetSetBits(const cIssueFilter::tBitset &bits)
+    {
+        std::vector<std::size_t> indices;
+        for (std::size_t i = 0; i < bits.size() * 64; ++i)
+        {
+            if ((bits[i / 64] >> (i % 64)) & 1ULL)
+                indices.push_back(i);
+        }
+        return indices;
+    }
 };
 
 TEST_F(cTesterReportModuleGui, CmdHelp)
@@ -82,3 +110,289 @@ TEST_F(cTesterReportModuleGui, CmdTooMuchArguments)
     TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, "a b");
     ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
 }
+
+TEST_F(cTesterReportModuleGui, IssueFilterComparison)
+{
+    cResultContainer referenceResults;
+    cCheckerBundle *pReferenceBundle = new cCheckerBundle("bundle", "", "");
+    referenceResults.AddCheckerBundle(pReferenceBundle);
+    cChecker *pReferenceChecker = pReferenceBundle->CreateChecker("checker");
+    pReferenceChecker->AddIssue(new cIssue("unchanged", ERROR_LVL, "rule.a"));
+    cIssue *pFixedIssue = pReferenceChecker->AddIssue(new cIssue("fixed", WARNING_LVL, "rule.b"));
+
+    cResultContainer results;
+    cCheckerBundle *pBundle = new cCheckerBundle("bundle", "", "");
+    results.AddCheckerBundle(pBundle);
+    cChecker *pChecker = pBundle->CreateChecker("checker");
+    cIssue *pUnchangedIssue = pChecker->AddIssue(new cIssue("unchanged", ERROR_LVL, "rule.a"));
+    cIssue *pNewIssue = pChecker->AddIssue(new cIssue("new", INFO_LVL, "rule.c"));
+
+    cResultDiff comparison;
+    comparison.Compare(referenceResults, results);
+
+    cIssueFilter filter;
+    filter.Build(&results, &comparison);
+
+    ASSERT_TRUE_EXT(filter.HasComparison(), "Filter has to contain the comparison");
+    ASSERT_TRUE_EXT(filter.GetComparisonCount(cIssueFilter::NEW_ISSUE) == 1, "Wrong count of new issues");
+    ASSERT_TRUE_EXT(filter.GetComparisonCount(cIssueFilter::FIXED_ISSUE) == 1, "Wrong count of fixed issues");
+    ASSERT_TRUE_EXT(filter.GetComparisonCount(cIssueFilter::UNCHANGED_ISSUE) == 1, "Wrong count of unchanged issues");
+
+    // Fixed issues follow the issues of the checker with the same name
+    ASSERT_TRUE_EXT(filter.GetIssueCount() == 3, "Wrong count of issues");
+    ASSERT_TRUE_EXT(filter.GetRange(pChecker) == cIssueFilter::tRange(0, 3), "Fixed issue has to be in the checker");
+    ASSERT_TRUE_EXT(filter.GetIssue(0) == pUnchangedIssue, "Wrong order of issues");
+    ASSERT_TRUE_EXT(filter.GetComparison(0) == cIssueFilter::UNCHANGED_ISSUE, "Issue has to be unchanged");
+    ASSERT_TRUE_EXT(filter.GetIssue(1) == pNewIssue, "Wrong order of issues");
+    ASSERT_TRUE_EXT(filter.GetComparison(1) == cIssueFilter::NEW_ISSUE, "Issue has to be new");
+    ASSERT_TRUE_EXT(filter.GetIssue(2) == pFixedIssue, "Wrong order of issues");
+    ASSERT_TRUE_EXT(filter.GetComparison(2) == cIssueFilter::FIXED_ISSUE, "Issue has to be fixed");
+
+    // Fixed issues belong to the reference results
+    const std::vector<cIssue *> containerIssues = filter.GetContainerIssues();
+    ASSERT_TRUE_EXT(containerIssues.size() == 2, "Wrong count of container issues");
+    ASSERT_TRUE_EXT(std::find(containerIssues.begin(), containerIssues.end(), pFixedIssue) == containerIssues.end(),
+                    "Container issues must not contain fixed issues");
+
+    filter.SetState(cIssueFilter::SHOW_ALL & ~(cIssueFilter::SHOW_FIXED_ISSUES | cIssueFilter::SHOW_UNCHANGED_ISSUES));
+    ASSERT_TRUE_EXT(filter.CountVisible(filter.GetRange()) == 1, "Only the new issue has to be visible");
+    ASSERT_TRUE_EXT(filter.IsVisible(1), "New issue has to be visible");
+
+    // Applying the filter changes only the container and can be undone
+    filter.ApplyToIssues();
+    ASSERT_TRUE_EXT(!pUnchangedIssue->IsEnabled() && pNewIssue->IsEnabled(), "Filter was not applied");
+    ASSERT_TRUE_EXT(pFixedIssue->IsEnabled(), "Reference issues must not be changed");
+
+    filter.RestoreIssues();
+    ASSERT_TRUE_EXT(pUnchangedIssue->IsEnabled() && pNewIssue->IsEnabled(), "Enabled state was not restored");
+}
+
+TEST_F(cTesterReportModuleGui, IssueSearchIndex)
+{
+    cResultContainer results;
+    cCheckerBundle *pBundle = new cCheckerBundle("bundle", "", "");
+    results.AddCheckerBundle(pBundle);
+    cChecker *pRoadChecker = pBundle->CreateChecker("roadChecker");
+    pRoadChecker->AddIssue(new cIssue("Road has a missing lane", ERROR_LVL, "asam.net:xodr:1.0.0:road.lane"));
+    pRoadChecker->AddIssue(new cIssue("Lane width is negative", WARNING_LVL, "asam.net:xodr:1.0.0:road.lane.width"));
+    cChecker *pJunctionChecker = pBundle->CreateChecker("junctionChecker");
+    cIssue *pJunctionIssue =
+        pJunctionChecker->AddIssue(new cIssue("Connection is missing", ERROR_LVL, "asam.net:xodr:1.0.0:junction"));
+    pJunctionIssue->AddLocationsContainer(
+        new cLocationsContainer("junction", new cXMLLocation("/OpenDRIVE/junction[1]")));
+
+    cIssueFilter filter;
+    filter.Build(&results);
+
+    std::atomic<bool> cancelled(false);
+    cIssueSearchIndex index;
+    index.Build(filter.GetIssues(), cancelled);
+
+    cIssueFilter::tBitset matches;
+
+    // Query tokens match all tokens they are a prefix of
+    ASSERT_TRUE_EXT(index.Search("junc", matches), "Query has to contain tokens");
+    ASSERT_TRUE_EXT(GetSetBits(matches) == std::vector<std::size_t>({2}), "Prefix has to match the junction issue");
+
+    // XPaths of the locations are indexed
+    ASSERT_TRUE_EXT(index.Search("opendrive", matches), "Query has to contain tokens");
+    ASSERT_TRUE_EXT(GetSetBits(matches) == std::vector<std::size_t>({2}), "XPath has to match the junction issue");
+
+    // Issues have to match all query tokens
+    ASSERT_TRUE_EXT(index.Search("lane miss", matches), "Query has to contain tokens");
+    ASSERT_TRUE_EXT(GetSetBits(matches) == std::vector<std::size_t>({0}), "Only the first issue matches both terms");
+
+    // Tokens are compared case-insensitively, the checker ID is indexed as well
+    ASSERT_TRUE_EXT(index.Search("ROAD", matches), "Query has to contain tokens");
+    ASSERT_TRUE_EXT(GetSetBits(matches) == std::vector<std::size_t>({0, 1}), "Road issues have to match");
+
+    ASSERT_TRUE_EXT(index.Search("tunnel", matches), "Query has to contain tokens");
+    ASSERT_TRUE_EXT(GetSetBits(matches).empty(), "Query must not match any issue");
+
+    ASSERT_TRUE_EXT(!index.Search(" .:", matches), "Query without tokens must not be searched");
+}
+
+TEST_F(cTesterReportModuleGui, IssueDensityBuckets)
+{
+    std::atomic<bool> cancelled(false);
+    cIssueDensityIndex index;
+
+    // Empty container
+    cResultContainer emptyResults;
+    cIssueFilter emptyFilter;
+    emptyFilter.Build(&emptyResults);
+    index.Build(emptyFilter.GetIssues(), {emptyFilter.GetRange()}, cancelled);
+
+    ASSERT_TRUE_EXT(index.GetLocationCount() == 0, "Empty container must not have file locations");
+    ASSERT_TRUE_EXT(index.GetLineCount() == 0, "Empty container must not have lines");
+    ASSERT_TRUE_EXT(index.CountLocationsPerBucket(index.GetLineCount(), 5).empty(), "No lines must give no buckets");
+
+    // Single issue in row 5, which is line 4
+    cResultContainer singleResults;
+    cCheckerBundle *pSingleBundle = new cCheckerBundle("bundle", "", "");
+    singleResults.AddCheckerBundle(pSingleBundle);
+    cIssue *pSingleIssue = pSingleBundle->CreateChecker("checker")->AddIssue(new cIssue("desc", ERROR_LVL, "rule.a"));
+    pSingleIssue->AddLocationsContainer(new cLocationsContainer("row 5", new cFileLocation(5, 1)));
+
+    cIssueFilter singleFilter;
+    singleFilter.Build(&singleResults);
+    index.Build(singleFilter.GetIssues(), {singleFilter.GetRange()}, cancelled);
+
+    ASSERT_TRUE_EXT(index.GetLocationCount() == 1, "Single issue has one file location");
+    ASSERT_TRUE_EXT(index.GetLineCount() == 5, "Lines have to end after the location");
+    ASSERT_TRUE_EXT(index.CountLocationsPerBucket(10, 5) == std::vector<std::size_t>({0, 0, 1, 0, 0}),
+                    "Location has to be counted in the third bucket");
+    ASSERT_TRUE_EXT(index.CountLocationsPerBucket(10, 20).size() == 10, "Every bucket has to cover a line");
+    ASSERT_TRUE_EXT(index.CountLocationsPerBucket(10, 0).empty(), "No buckets must give no counts");
+
+    // Several issues, the buckets cover the lines [0, 3), [3, 6) and [6, 10)
+    cResultContainer results;
+    cCheckerBundle *pBundle = new cCheckerBundle("bundle", "", "");
+    results.AddCheckerBundle(pBundle);
+    cChecker *pChecker = pBundle->CreateChecker("checker");
+    for (const int row : {1, 2, 2, 10})
+    {
+        cIssue *pIssue = pChecker->AddIssue(new cIssue("desc", WARNING_LVL, "rule.a"));
+        pIssue->AddLocationsContainer(new cLocationsContainer("row", new cFileLocation(row, 1)));
+    }
+
+    cIssueFilter filter;
+    filter.Build(&results);
+    index.Build(filter.GetIssues(), {filter.GetRange()}, cancelled);
+
+    ASSERT_TRUE_EXT(index.GetLineCount() == 10, "Lines have to end after the last location");
+    ASSERT_TRUE_EXT(index.CountLocationsPerBucket(10, 3) == std::vector<std::size_t>({3, 0, 1}),
+                    "Locations have to be counted per bucket");
+    ASSERT_TRUE_EXT(cIssueDensityIndex::GetBucketBegin(1, 10, 3) == 3, "Second bucket has to start at line 3");
+    ASSERT_TRUE_EXT(cIssueDensityIndex::GetBucketBegin(3, 10, 3) == 10, "Buckets have to end after the last line");
+
+    cIssueFilter::tBitset issues;
+    index.GetIssues(0, 3, issues);
+    ASSERT_TRUE_EXT(GetSetBits(issues) == std::vector<std::size_t>({0, 1, 2}), "First bucket has three issues");
+}
+
+TEST_F(cTesterReportModuleGui, ViewerIssueRecords)
+{
+    cResultContainer results;
+    cCheckerBundle *pBundle = new cCheckerBundle("bundle", "", "");
+    results.AddCheckerBundle(pBundle);
+    cChecker *pChecker = pBundle->CreateChecker("checker");
+
+    // One record per inertial or time location
+    cIssue *pLocatedIssue = pChecker->AddIssue(new cIssue("Located", ERROR_LVL, "rule.a"));
+    pLocatedIssue->AddLocationsContainer(new cLocationsContainer("xml", new cXMLLocation("/OpenDRIVE/road[1]")));
+    pLocatedIssue->AddLocationsContainer(new cLocationsContainer("inertial", new cInertialLocation(1.0, 2.0, 3.0)));
+    pLocatedIssue->AddLocationsContainer(new cLocationsContainer("time", new cTimeLocation(4.5)));
+
+    // Issues without inertial or time location have a single record
+    cIssue *pXmlIssue = pChecker->AddIssue(new cIssue("Located", WARNING_LVL, "rule.a"));
+    pXmlIssue->AddLocationsContainer(new cLocationsContainer("xml", new cXMLLocation("/OpenDRIVE/road[2]")));
+    cIssue *pPlainIssue = pChecker->AddIssue(new cIssue("Plain", INFO_LVL, ""));
+
+    cIssueFilter filter;
+    filter.Build(&results);
+
+    cViewerIssueRecords viewerRecords(filter.GetIssues());
+    const tViewerIssueRecords *pRecords = viewerRecords.GetRecords();
+
+    ASSERT_TRUE_EXT(pRecords->version == VIEWER_ISSUE_RECORDS_VERSION, "Records have to carry the version");
+    ASSERT_TRUE_EXT(pRecords->recordSize == sizeof(tViewerIssueRecord), "Records have to carry the record size");
+    ASSERT_TRUE_EXT(pRecords->recordCount == 4, "Issues have to be flattened into four records");
+
+    // Rules and descriptions are stored once
+    ASSERT_TRUE_EXT(pRecords->ruleCount == 1 && std::string(pRecords->rules[0]) == "rule.a",
+                    "Rule UID table has to contain every rule once");
+    ASSERT_TRUE_EXT(pRecords->descriptionCount == 2 && std::string(pRecords->descriptions[0]) == "Located" &&
+                        std::string(pRecords->descriptions[1]) == "Plain",
+                    "Description table has to contain every description once");
+
+    const cIssue *pExpectedIssues[] = {pLocatedIssue, pLocatedIssue, pXmlIssue, pPlainIssue};
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        const tViewerIssueRecord &record = pRecords->records[i];
+        ASSERT_TRUE_EXT(record.issue == pExpectedIssues[i], "Record has to point to its issue");
+        ASSERT_TRUE_EXT(record.issueId == pExpectedIssues[i]->GetIssueId(), "Record has to carry the issue ID");
+        ASSERT_TRUE_EXT(record.level == (uint32_t)pExpectedIssues[i]->GetIssueLevel(),
+                        "Record has to carry the issue level");
+        ASSERT_TRUE_EXT(std::string(pRecords->descriptions[record.descriptionIndex]) ==
+                            pExpectedIssues[i]->GetDescription(),
+                        "Record has to refer to the issue description");
+    }
+
+    const tViewerIssueRecord &inertialRecord = pRecords->records[0];
+    ASSERT_TRUE_EXT(inertialRecord.locationType == VIEWER_LOCATION_INERTIAL, "First record is the inertial location");
+    ASSERT_TRUE_EXT(inertialRecord.locationIndex == 1, "Location index has to count all locations of the issue");
+    ASSERT_TRUE_EXT(inertialRecord.x == 1.0 && inertialRecord.y == 2.0 && inertialRecord.z == 3.0,
+                    "Inertial coordinates have to be passed");
+    ASSERT_TRUE_EXT(inertialRecord.ruleIndex == 0, "Record has to refer to the rule UID");
+
+    const tViewerIssueRecord &timeRecord = pRecords->records[1];
+    ASSERT_TRUE_EXT(timeRecord.locationType == VIEWER_LOCATION_TIME, "Second record is the time location");
+    ASSERT_TRUE_EXT(timeRecord.locationIndex == 2, "Location index has to count all locations of the issue");
+    ASSERT_TRUE_EXT(timeRecord.time == 4.5, "Time has to be passed");
+
+    for (std::size_t i = 2; i < 4; ++i)
+    {
+        ASSERT_TRUE_EXT(pRecords->records[i].locationType == VIEWER_LOCATION_NONE, "Record must not have a location");
+        ASSERT_TRUE_EXT(pRecords->records[i].locationIndex == VIEWER_NO_INDEX, "Record must not have a location");
+    }
+
+    ASSERT_TRUE_EXT(pRecords->records[3].ruleIndex == VIEWER_NO_INDEX, "Issue without rule UID must not have a rule");
+}
+
+TEST_F(cTesterReportModuleGui, IssueFilterLevels)
+{
+    cResultContainer results;
+    cCheckerBundle *pBundle = new cCheckerBundle("bundle", "", "");
+    results.AddCheckerBundle(pBundle);
+    cChecker *pChecker = pBundle->CreateChecker("checker");
+    pChecker->AddIssue(new cIssue("info", INFO_LVL, "rule.a"));
+    pChecker->AddIssue(new cIssue("warning", WARNING_LVL, "rule.a"));
+    pChecker->AddIssue(new cIssue("error", ERROR_LVL, "rule.b"));
+    pChecker->AddIssue(new cIssue("info without rule", INFO_LVL, ""));
+    pChecker->AddIssue(new cIssue("info without rule", INFO_LVL, ""));
+
+    cIssueFilter filter;
+    filter.Build(&results);
+
+    auto getVisible = [&filter]() {
+        std::vector<std::size_t> visible;
+        for (std::size_t i = 0; i < filter.GetIssueCount(); ++i)
+        {
+            if (filter.IsVisible(i))
+                visible.push_back(i);
+        }
+        return visible;
+    };
+
+    ASSERT_TRUE_EXT(filter.GetState() == cIssueFilter::SHOW_ALL, "Filter has to show all issues after building");
+    ASSERT_TRUE_EXT(getVisible() == std::vector<std::size_t>({0, 1, 2, 3, 4}), "All issues have to be visible");
+
+    // Every level on its own
+    const int otherBits = cIssueFilter::SHOW_ALL & ~(cIssueFilter::SHOW_INFO_LEVEL | cIssueFilter::SHOW_WARNING_LEVEL |
+                                                     cIssueFilter::SHOW_ERROR_LEVEL);
+
+    filter.SetState(otherBits | cIssueFilter::SHOW_INFO_LEVEL);
+    ASSERT_TRUE_EXT(getVisible() == std::vector<std::size_t>({0, 3, 4}), "Only info issues have to be visible");
+
+    filter.SetState(otherBits | cIssueFilter::SHOW_WARNING_LEVEL);
+    ASSERT_TRUE_EXT(getVisible() == std::vector<std::size_t>({1}), "Only warning issues have to be visible");
+
+    filter.SetState(otherBits | cIssueFilter::SHOW_ERROR_LEVEL);
+    ASSERT_TRUE_EXT(getVisible() == std::vector<std::size_t>({2}), "Only error issues have to be visible");
+
+    filter.SetState(otherBits);
+    ASSERT_TRUE_EXT(getVisible().empty(), "No issue has to be visible without levels");
+    ASSERT_TRUE_EXT(filter.CountVisible(filter.GetRange()) == 0, "No issue has to be counted without levels");
+
+    // Only the first issue of a rule UID is shown without repetitive issues, issues without rule UID are kept
+    filter.SetState(cIssueFilter::SHOW_ALL & ~cIssueFilter::SHOW_REPETITIVE_ISSUES);
+    ASSERT_TRUE_EXT(getVisible() == std::vector<std::size_t>({0, 2, 3, 4}), "Repetitive issue has to be hidden");
+    ASSERT_TRUE_EXT(filter.CountVisible(filter.GetRange()) == 4, "Repetitive issue must not be counted");
+
+    filter.SetState(cIssueFilter::SHOW_WARNING_LEVEL);
+    ASSERT_TRUE_EXT(getVisible().empty(), "Repetitive warning has to stay hidden");
+
+    filter.SetState(cIssueFilter::SHOW_ALL);
+    ASSERT_TRUE_EXT(getVisible() == std::vector<std::size_t>({0, 1, 2, 3, 4}), "All issues have to be visible again");
+}
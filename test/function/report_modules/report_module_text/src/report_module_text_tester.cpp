@@ -12,6 +12,8 @@
 
 #include "helper.h"
 
+#include <fstream>
+
 #define MODULE_NAME "TextReport"
 
 class cTesterReportModuleText : public ::testing::Test
@@ -19,6 +21,47 @@ class cTesterReportModuleText : public ::testing::Test
   public:
     std::string strTestFilesDir = std::string(QC4OPENX_DBQA_REPORT_MODULE_TEXT_TEST_REF_DIR);
     std::string strWorkingDir = std::string(QC4OPENX_DBQA_REPORT_MODULE_TEXT_TEST_WORK_DIR);
+
+    // Returns the content of a file
+    std::string ReadFile(const std::string &strFilePath)
+    {
+        std::ifstream file(strFilePath);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+
+    // Writes a result file with enough issues to be rendered in several chunks
+    void WriteResultWithManyIssues(const std::string &strFilePath, unsigned int issueCount)
+    {
+        std::ofstream file(strFilePath);
+        file << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\" ?>\n";
+        file << "<CheckerResults version=\"1.0.0\">\n";
+        file << "  <CheckerBundle build_date=\"\" description=\"\" name=\"ManyIssuesBundle\" summary=\"\" "
+                "version=\"\">\n";
+        for (unsigned int checker = 0; checker < 3; checker++)
+        {
+            file << "    <Checker checkerId=\"checker" << checker
+                 << "\" description=\"\" status=\"completed\" summary=\"\">\n";
+            for (unsigned int i = checker; i < issueCount; i += 3)
+            {
+                file << "      <Issue description=\"Issue " << i << "\" issueId=\"" << i << "\" level=\""
+                     << (i % 3) + 1 << "\" ruleUID=\"asam.net:xodr:1.0.0:rule_" << (i % 7) << "\">\n";
+                file << "        <Locations description=\"location " << i << "\">\n";
+                file << "          <XMLLocation xpath=\"/OpenDRIVE/road[" << i << "]\"/>\n";
+                file << "          <InertialLocation x=\"" << i << ".5\" y=\"2.0\" z=\"0.0\"/>\n";
+                file << "        </Locations>\n";
+                if (i % 5 == 0)
+                {
+                    file << "        <DomainSpecificInfo name=\"test_domain\">\n";
+                    file << "          <RoadLocation b=\"5.4\" c=\"0.0\" id=\"" << i << "\"/>\n";
+                    file << "        </DomainSpecificInfo>\n";
+                }
+                file << "      </Issue>\n";
+            }
+            file << "    </Checker>\n";
+        }
+        file << "  </CheckerBundle>\n";
+        file << "</CheckerResults>\n";
+    }
 };
 
 TEST_F(cTesterReportModuleText, CmdBasic)
@@ -56,6 +99,84 @@ TEST_F(cTesterReportModuleText, CmdConfig)
     ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
 }
 
+TEST_F(cTesterReportModuleText, CmdConfigSummary)
+{
+    std::string strResultMessage;
+
+    std::string strConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_summary_config.xml";
+    std::string strReportFilePath = strWorkingDir + "/" + "Report.txt";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strConfigFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    std::string strReport = ReadFile(strReportFilePath);
+    ASSERT_TRUE_EXT(strReport.find("Pooled results summary") != std::string::npos, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(strReport.find("Issues per checker") != std::string::npos, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(strReport.find("Issues per rule") != std::string::npos, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(strReport.find("Top 3 rules by issue count") != std::string::npos, strResultMessage.c_str());
+
+    nRes |= CheckFileExists(strResultMessage, strReportFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+}
+
+TEST_F(cTesterReportModuleText, CmdConfigTop)
+{
+    std::string strResultMessage;
+
+    std::string strConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_top_config.xml";
+    std::string strReportFilePath = strWorkingDir + "/" + "Report.txt";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strConfigFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    std::string strReport = ReadFile(strReportFilePath);
+    ASSERT_TRUE_EXT(strReport.find("Top 1 rules by issue count") != std::string::npos, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(strReport.find("Issues per checker") == std::string::npos, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(strReport.find("Issues per rule") == std::string::npos, strResultMessage.c_str());
+
+    nRes |= CheckFileExists(strResultMessage, strReportFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+}
+
+TEST_F(cTesterReportModuleText, CmdConfigReportModeNotValid)
+{
+    std::string strResultMessage;
+
+    std::string strConfigFilePath = strTestFilesDir + "/" + std::string(MODULE_NAME) + "_invalid_mode_config.xml";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strConfigFilePath);
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+}
+
+TEST_F(cTesterReportModuleText, CmdConfigThreadCount)
+{
+    std::string strResultMessage;
+
+    std::string strResultFilePath = strWorkingDir + "/" + "ResultManyIssues.xqar";
+    std::string strSequentialReportFilePath = strWorkingDir + "/" + "Report_threads_1.txt";
+    std::string strParallelReportFilePath = strWorkingDir + "/" + "Report_threads_4.txt";
+
+    WriteResultWithManyIssues(strResultFilePath, 3000);
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                                     strTestFilesDir + "/" + std::string(MODULE_NAME) + "_threads_1_config.xml");
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                          strTestFilesDir + "/" + std::string(MODULE_NAME) + "_threads_4_config.xml");
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    // The chunks rendered in parallel are written in the order of the sequential report
+    std::string strSequentialReport = ReadFile(strSequentialReportFilePath);
+    std::string strParallelReport = ReadFile(strParallelReportFilePath);
+    ASSERT_TRUE_EXT(strSequentialReport.find("Issue 2999") != std::string::npos, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(strSequentialReport == strParallelReport, strResultMessage.c_str());
+
+    fs::remove(strResultFilePath.c_str());
+    fs::remove(strSequentialReportFilePath.c_str());
+    fs::remove(strParallelReportFilePath.c_str());
+}
+
 TEST_F(cTesterReportModuleText, CmdXqar)
 {
     std::string strResultMessage;
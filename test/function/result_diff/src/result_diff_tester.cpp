@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MPL-2.0
+/*
+ * Copyright 2024 ASAM e.V.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla
+ * Public License, v. 2.0. If a copy of the MPL was not distributed
+ * with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "common/result_format/c_result_container.h"
+#include "helper.h"
+#include "gtest/gtest.h"
+
+#include <fstream>
+
+#define MODULE_NAME "ResultDiff"
+
+class cTesterResultDiff : public ::testing::Test
+{
+  public:
+    std::string strTestFilesDir = std::string(QC4OPENX_DBQA_RESULT_DIFF_TEST_REF_DIR);
+    std::string strWorkingDir = std::string(QC4OPENX_DBQA_RESULT_DIFF_TEST_WORK_DIR);
+};
+
+TEST_F(cTesterResultDiff, CmdDiffUnchanged)
+{
+    std::string strResultMessage;
+
+    std::string strInputFilePath = strTestFilesDir + "/" + "DemoCheckerBundle.xqar";
+    std::string strDiffFilePath = strWorkingDir + "/" + "Diff.xqar";
+    std::string strRemovedFilePath = strWorkingDir + "/" + "Diff_removed.xqar";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                                     strInputFilePath + " " + strInputFilePath + " " + strDiffFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    cResultContainer addedResults;
+    addedResults.AddResultsFromXML(strDiffFilePath);
+    ASSERT_TRUE_EXT(addedResults.GetIssueCount() == 0, strResultMessage.c_str());
+
+    cResultContainer removedResults;
+    removedResults.AddResultsFromXML(strRemovedFilePath);
+    ASSERT_TRUE_EXT(removedResults.GetIssueCount() == 0, strResultMessage.c_str());
+
+    fs::remove(strDiffFilePath.c_str());
+    fs::remove(strRemovedFilePath.c_str());
+}
+
+TEST_F(cTesterResultDiff, CmdDiffAddedAndRemoved)
+{
+    std::string strResultMessage;
+
+    std::string strEmptyFilePath = strTestFilesDir + "/" + "EmptyResult.xqar";
+    std::string strInputFilePath = strTestFilesDir + "/" + "DemoCheckerBundle.xqar";
+    std::string strDiffFilePath = strWorkingDir + "/" + "Diff.xqar";
+    std::string strRemovedFilePath = strWorkingDir + "/" + "Diff_removed.xqar";
+
+    // All issues of the current results are new
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                                     strEmptyFilePath + " " + strInputFilePath + " " + strDiffFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    {
+        cResultContainer addedResults;
+        addedResults.AddResultsFromXML(strDiffFilePath);
+        ASSERT_TRUE_EXT(addedResults.GetIssueCount() == 5, strResultMessage.c_str());
+    }
+
+    // All issues of the base results are gone
+    nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                          strInputFilePath + " " + strEmptyFilePath + " " + strDiffFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    {
+        cResultContainer removedResults;
+        removedResults.AddResultsFromXML(strRemovedFilePath);
+        ASSERT_TRUE_EXT(removedResults.GetIssueCount() == 5, strResultMessage.c_str());
+    }
+
+    fs::remove(strDiffFilePath.c_str());
+    fs::remove(strRemovedFilePath.c_str());
+}
+
+TEST_F(cTesterResultDiff, CmdDiffTextReport)
+{
+    std::string strResultMessage;
+
+    std::string strEmptyFilePath = strTestFilesDir + "/" + "EmptyResult.xqar";
+    std::string strInputFilePath = strTestFilesDir + "/" + "DemoCheckerBundle.xqar";
+    std::string strDiffFilePath = strWorkingDir + "/" + "Diff.txt";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                                     strEmptyFilePath + " " + strInputFilePath + " " + strDiffFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    std::ifstream diffFile(strDiffFilePath);
+    std::string strDiffContent((std::istreambuf_iterator<char>(diffFile)), std::istreambuf_iterator<char>());
+    diffFile.close();
+
+    ASSERT_TRUE_EXT(strDiffContent.find("Added:     5") != std::string::npos, strResultMessage.c_str());
+    ASSERT_TRUE_EXT(strDiffContent.find("Removed:   0") != std::string::npos, strResultMessage.c_str());
+
+    fs::remove(strDiffFilePath.c_str());
+}
+
+TEST_F(cTesterResultDiff, CmdDiffFileNotExisting)
+{
+    std::string strResultMessage;
+
+    std::string strInputFilePath = strTestFilesDir + "/" + "DemoCheckerBundle.xqar";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                                     strInputFilePath + " " + strTestFilesDir + "/" + "NotExisting.xqar");
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+}
+
+TEST_F(cTesterResultDiff, CmdDiffWriteBaseline)
+{
+    std::string strResultMessage;
+
+    std::string strInputFilePath = strTestFilesDir + "/" + "DemoCheckerBundle.xqar";
+    std::string strBaselineFilePath = strWorkingDir + "/" + "baseline.txt";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                                     "--write_baseline " + strInputFilePath + " " + strBaselineFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    nRes |= CheckFileExists(strResultMessage, strBaselineFilePath, false);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    fs::remove(strBaselineFilePath.c_str());
+}
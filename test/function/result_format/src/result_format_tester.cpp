@@ -9,14 +9,22 @@
 
 #include "gtest/gtest.h"
 
+#include "common/c_logger.h"
 #include "common/result_format/c_checker_bundle.h"
 #include "common/result_format/c_domain_specific_info.h"
+#include "common/result_format/c_inertial_location.h"
 #include "common/result_format/c_issue.h"
+#include "common/result_format/c_issue_baseline.h"
+#include "common/result_format/c_issue_fingerprint.h"
 #include "common/result_format/c_locations_container.h"
 #include "common/result_format/c_message_location.h"
 #include "common/result_format/c_time_location.h"
 #include "common/result_format/c_result_container.h"
+#include "common/result_format/c_result_diff.h"
+#include "common/result_format/c_xml_location.h"
 #include "helper.h"
+#include <atomic>
+#include <fstream>
 #include <xercesc/util/PlatformUtils.hpp>
 
 #define MODULE_NAME "ResultFormat"
@@ -100,3 +108,446 @@ TEST_F(cTesterResultFormat, DomainSpecificInfoReadWrite)
     delete pResultContainer;
     XERCES_CPP_NAMESPACE::XMLPlatformUtils::Terminate();
 }
+
+TEST_F(cTesterResultFormat, DomainSpecificInfoLazyDom)
+{
+    XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
+    std::string strResultMessage;
+    std::string strFilePath = strTestFilesDir + "/result_domain_info.xqar";
+    std::string strResultFile = strWorkingDir + "/output_lazy.xqar";
+
+    cResultContainer *pResultContainer = new cResultContainer();
+    pResultContainer->AddResultsFromXML(strFilePath);
+
+    std::list<cIssue *> issues = pResultContainer->GetIssues();
+    ASSERT_TRUE_EXT(issues.size() == 1, "Unexpected number of issues");
+    std::list<cDomainSpecificInfo *> domainInfos = issues.front()->GetDomainSpecificInfo();
+    ASSERT_TRUE_EXT(domainInfos.size() == 1, "Unexpected number of domain specific infos");
+
+    // The DOM must not be created while parsing
+    cDomainSpecificInfo *pDomainInfo = domainInfos.front();
+    ASSERT_TRUE_EXT(!pDomainInfo->IsMaterialized(), "Domain specific info was materialized during parsing");
+    ASSERT_TRUE_EXT(pDomainInfo->GetName() == "test_domain", "Unexpected domain specific info name");
+    ASSERT_TRUE_EXT(pDomainInfo->GetFragment().find("RoadLocation") != std::string::npos,
+                    "Fragment does not contain the domain specific payload");
+
+    // Writing the results does not need the DOM either
+    pResultContainer->WriteResults(strResultFile);
+    ASSERT_TRUE_EXT(!pDomainInfo->IsMaterialized(), "Domain specific info was materialized during writing");
+    TestResult nRes = XmlContainsNode(strResultFile, "RoadLocation");
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, "Written result does not contain the domain specific payload");
+
+    // The DOM is created on first access
+    DOMElement *pRoot = pDomainInfo->GetRoot();
+    ASSERT_TRUE_EXT(nullptr != pRoot, "Could not create DOM from fragment");
+    ASSERT_TRUE_EXT(pDomainInfo->IsMaterialized(), "Domain specific info was not materialized");
+    ASSERT_TRUE_EXT(nullptr != pRoot->getFirstElementChild(), "Root has no child element");
+
+    delete pResultContainer;
+    XERCES_CPP_NAMESPACE::XMLPlatformUtils::Terminate();
+}
+
+TEST_F(cTesterResultFormat, IssueCounters)
+{
+    cResultContainer *pResultContainer = new cResultContainer();
+    cCheckerBundle *pBundle = new cCheckerBundle("TestBundle", "", "");
+    pResultContainer->AddCheckerBundle(pBundle);
+
+    cChecker *pFirstChecker = pBundle->CreateChecker("firstChecker");
+    cChecker *pSecondChecker = pBundle->CreateChecker("secondChecker");
+
+    cIssue *pError = pFirstChecker->AddIssue(new cIssue("error", ERROR_LVL, ""));
+    pFirstChecker->AddIssue(new cIssue("warning", WARNING_LVL, ""));
+    cIssue *pInfo = pFirstChecker->AddIssue(new cIssue("info", INFO_LVL, ""));
+    pSecondChecker->AddIssue(new cIssue("error", ERROR_LVL, ""));
+
+    ASSERT_TRUE_EXT(pFirstChecker->GetIssueCount() == 3, "Wrong checker issue count");
+    ASSERT_TRUE_EXT(pBundle->GetIssueCount() == 4, "Wrong bundle issue count");
+    ASSERT_TRUE_EXT(pBundle->GetIssueCount(ERROR_LVL) == 2, "Wrong bundle error count");
+    ASSERT_TRUE_EXT(pResultContainer->GetIssueCount(WARNING_LVL) == 1, "Wrong container warning count");
+
+    // Disabling and changing the level is reflected in checker and bundle
+    pError->SetEnabled(false);
+    ASSERT_TRUE_EXT(pFirstChecker->GetEnabledIssuesCount() == 2, "Wrong enabled checker issue count");
+    ASSERT_TRUE_EXT(pBundle->GetEnabledIssuesCount(ERROR_LVL) == 1, "Wrong enabled bundle error count");
+    pInfo->SetLevel(WARNING_LVL);
+    ASSERT_TRUE_EXT(pBundle->GetIssueCount(INFO_LVL) == 0, "Wrong bundle info count after level change");
+    ASSERT_TRUE_EXT(pBundle->GetEnabledIssuesCount(WARNING_LVL) == 2, "Wrong bundle warning count");
+
+    // Filtering keeps only errors
+    pFirstChecker->FilterIssues(ERROR_LVL, ERROR_LVL);
+    ASSERT_TRUE_EXT(pFirstChecker->GetIssueCount() == 1, "Wrong checker issue count after filtering");
+    ASSERT_TRUE_EXT(pBundle->GetIssueCount() == 2, "Wrong bundle issue count after filtering");
+    ASSERT_TRUE_EXT(pBundle->GetEnabledIssuesCount() == 1, "Wrong enabled bundle issue count after filtering");
+
+    // Removing a checker removes its issues from the bundle
+    pBundle->KeepCheckersFrom({"secondChecker"});
+    ASSERT_TRUE_EXT(pBundle->GetCheckerCount() == 1, "Wrong checker count");
+    ASSERT_TRUE_EXT(pBundle->GetIssueCount() == 1, "Wrong bundle issue count after removing a checker");
+    ASSERT_TRUE_EXT(pResultContainer->GetEnabledIssuesCount() == 1, "Wrong enabled container issue count");
+
+    delete pResultContainer;
+}
+
+TEST_F(cTesterResultFormat, DoProcessingParallel)
+{
+    cResultContainer *pResultContainer = new cResultContainer();
+    cCheckerBundle *pBundle = new cCheckerBundle("TestBundle", "", "");
+    pResultContainer->AddCheckerBundle(pBundle);
+
+    const unsigned int checkerCount = 8;
+    const unsigned int issuesPerChecker = 100;
+    for (unsigned int i = 0; i < checkerCount; i++)
+    {
+        cChecker *pChecker = pBundle->CreateChecker("checker" + std::to_string(i));
+        for (unsigned int j = 0; j < issuesPerChecker; j++)
+            pChecker->AddIssue(new cIssue("issue", INFO_LVL, ""));
+    }
+
+    std::atomic<unsigned int> processedCount(0);
+    pResultContainer->DoProcessing(
+        [&processedCount](cCheckerBundle *, cChecker *, cIssue *issue) {
+            issue->SetDescription("processed");
+            processedCount++;
+        },
+        eExecutionPolicy::PARALLEL);
+
+    ASSERT_TRUE_EXT(processedCount == checkerCount * issuesPerChecker, "Not all issues were processed");
+    for (cIssue *issue : pResultContainer->GetIssues())
+    {
+        ASSERT_TRUE_EXT(issue->GetDescription() == "processed", "Issue was not processed");
+    }
+
+    delete pResultContainer;
+}
+
+TEST_F(cTesterResultFormat, DoProcessingParallelChangesIssues)
+{
+    cResultContainer *pResultContainer = new cResultContainer();
+    cCheckerBundle *pFirstBundle = new cCheckerBundle("FirstBundle", "", "");
+    cCheckerBundle *pSecondBundle = new cCheckerBundle("SecondBundle", "", "");
+    pResultContainer->AddCheckerBundle(pFirstBundle);
+    pResultContainer->AddCheckerBundle(pSecondBundle);
+
+    // One large checker and empty checkers, so chunks cross the checker boundaries
+    pFirstBundle->CreateChecker("empty");
+    cChecker *pLargeChecker = pFirstBundle->CreateChecker("large");
+    pSecondBundle->CreateChecker("empty");
+    cChecker *pSmallChecker = pSecondBundle->CreateChecker("small");
+
+    const unsigned int largeCount = 10000;
+    const unsigned int smallCount = 10;
+    for (unsigned int i = 0; i < largeCount; i++)
+        pLargeChecker->AddIssue(new cIssue("FirstBundle/large", INFO_LVL, ""));
+    for (unsigned int i = 0; i < smallCount; i++)
+        pSmallChecker->AddIssue(new cIssue("SecondBundle/small", INFO_LVL, ""));
+
+    // Builds the query index, which has to be dropped after processing
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().AddLevel(ERROR_LVL)).empty(), "Unexpected errors");
+
+    std::atomic<unsigned int> wrongParents(0);
+    pResultContainer->DoProcessing(
+        [&wrongParents](cCheckerBundle *bundle, cChecker *checker, cIssue *issue) {
+            if (issue->GetDescription() != bundle->GetBundleName() + "/" + checker->GetCheckerID())
+                wrongParents++;
+
+            // Every second issue becomes an error, every fourth issue is disabled
+            if (issue->GetIssueId() % 2 == 0)
+                issue->SetLevel(ERROR_LVL);
+            if (issue->GetIssueId() % 4 == 0)
+                issue->SetEnabled(false);
+        },
+        eExecutionPolicy::PARALLEL);
+
+    ASSERT_TRUE_EXT(wrongParents == 0, "Issues were processed with wrong checker or bundle");
+
+    unsigned int errorCount = 0;
+    unsigned int enabledCount = 0;
+    for (cIssue *issue : pLargeChecker->GetIssues())
+    {
+        errorCount += (issue->GetIssueLevel() == ERROR_LVL) ? 1 : 0;
+        enabledCount += issue->IsEnabled() ? 1 : 0;
+    }
+    ASSERT_TRUE_EXT(pLargeChecker->GetIssueCount(ERROR_LVL) == errorCount, "Wrong error count of checker");
+    ASSERT_TRUE_EXT(pLargeChecker->GetEnabledIssuesCount() == enabledCount, "Wrong enabled count of checker");
+    ASSERT_TRUE_EXT(pFirstBundle->GetIssueCount() == largeCount, "Wrong issue count of bundle");
+    ASSERT_TRUE_EXT(pFirstBundle->GetIssueCounter().GetCount(ERROR_LVL) == errorCount, "Wrong error count of bundle");
+    ASSERT_TRUE_EXT(pFirstBundle->GetIssueCounter().GetEnabledCount() == enabledCount,
+                    "Wrong enabled count of bundle");
+    ASSERT_TRUE_EXT(pFirstBundle->GetIssueCounter().GetCount(ERROR_LVL) +
+                            pSecondBundle->GetIssueCounter().GetCount(ERROR_LVL) ==
+                        pResultContainer->Query(cResultQuery().AddLevel(ERROR_LVL)).size(),
+                    "Query index was not updated after processing");
+
+    delete pResultContainer;
+}
+
+TEST_F(cTesterResultFormat, QueryIssues)
+{
+    cResultContainer *pResultContainer = new cResultContainer();
+    cCheckerBundle *pXodrBundle = new cCheckerBundle("xodrBundle", "", "");
+    cCheckerBundle *pXoscBundle = new cCheckerBundle("xoscBundle", "", "");
+    pResultContainer->AddCheckerBundle(pXodrBundle);
+    pResultContainer->AddCheckerBundle(pXoscBundle);
+
+    cChecker *pRoadChecker = pXodrBundle->CreateChecker("roadChecker");
+    cChecker *pScenarioChecker = pXoscBundle->CreateChecker("scenarioChecker");
+
+    pRoadChecker->AddIssue(new cIssue("road 7 error", ERROR_LVL, "asam.net:xodr:1.7.0:road.id",
+                                      new cLocationsContainer("", new cXMLLocation("/OpenDRIVE/road[@id='7']"))));
+    pRoadChecker->AddIssue(new cIssue("road 8 warning", WARNING_LVL, "asam.net:xodr:1.7.0:road.id",
+                                      new cLocationsContainer("", new cXMLLocation("/OpenDRIVE/road[@id='8']"))));
+    pRoadChecker->AddIssue(new cIssue("inertial error", ERROR_LVL, "asam.net:xodr:1.7.0:geometry",
+                                      new cLocationsContainer("", new cInertialLocation(10.0, 20.0, 0.0))));
+    pScenarioChecker->AddIssue(new cIssue("scenario error", ERROR_LVL, "asam.net:xosc:1.2.0:entity",
+                                          new cLocationsContainer("", new cTimeLocation(2.5))));
+
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery()).size() == 4, "Empty query has to return all issues");
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().AddLevel(ERROR_LVL)).size() == 3, "Wrong error count");
+    ASSERT_TRUE_EXT(
+        pResultContainer->Query(cResultQuery().AddLevel(ERROR_LVL).SetRuleUIDPrefix("asam.net:xodr")).size() == 2,
+        "Wrong count for level and rule prefix");
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().SetRuleUID("asam.net:xodr:1.7.0:road.id")).size() == 2,
+                    "Wrong count for rule UID");
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().SetBundleName("xoscBundle")).size() == 1,
+                    "Wrong count for bundle");
+    ASSERT_TRUE_EXT(
+        pResultContainer->Query(cResultQuery().AddLocationType(eLocationType::INERTIAL_LOCATION)).size() == 1,
+        "Wrong count for location type");
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().SetTimeRange(2.0, 3.0)).size() == 1,
+                    "Wrong count for time range");
+    ASSERT_TRUE_EXT(
+        pResultContainer->Query(cResultQuery().SetInertialRange(0.0, 0.0, -1.0, 15.0, 25.0, 1.0)).size() == 1,
+        "Wrong count for inertial range");
+
+    std::vector<cIssueHandle> handles =
+        pResultContainer->Query(cResultQuery().SetXPathPrefix("/OpenDRIVE/road[@id='7']").SetCheckerID("roadChecker"));
+    ASSERT_TRUE_EXT(handles.size() == 1, "Wrong count for xpath prefix");
+    ASSERT_TRUE_EXT(handles[0].bundle == pXodrBundle && handles[0].checker == pRoadChecker,
+                    "Wrong parents in issue handle");
+    ASSERT_TRUE_EXT(handles[0].issue->GetDescription() == "road 7 error", "Wrong issue in handle");
+
+    // Changes of the results are visible to later queries
+    pScenarioChecker->AddIssue(new cIssue("scenario warning", WARNING_LVL, "asam.net:xosc:1.2.0:entity"));
+    handles[0].issue->SetLevel(INFO_LVL);
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().AddLevel(ERROR_LVL)).size() == 2,
+                    "Wrong error count after changing results");
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().SetBundleName("xoscBundle")).size() == 2,
+                    "Wrong bundle count after changing results");
+
+    delete pResultContainer;
+}
+
+TEST_F(cTesterResultFormat, QueryIssuesUnbalancedPredicates)
+{
+    cResultContainer *pResultContainer = new cResultContainer();
+    cCheckerBundle *pBundle = new cCheckerBundle("bundle", "", "");
+    pResultContainer->AddCheckerBundle(pBundle);
+
+    cChecker *pLargeChecker = pBundle->CreateChecker("largeChecker");
+    cChecker *pSmallChecker = pBundle->CreateChecker("smallChecker");
+
+    for (unsigned int i = 0; i < 2000; i++)
+        pLargeChecker->AddIssue(new cIssue("info", INFO_LVL, "asam.net:xodr:1.7.0:large"));
+    for (unsigned int i = 0; i < 5; i++)
+    {
+        pSmallChecker->AddIssue(new cIssue("error", ERROR_LVL, "asam.net:xodr:1.7.0:small"));
+        pSmallChecker->AddIssue(new cIssue("warning", WARNING_LVL, "asam.net:xodr:1.7.0:small"));
+    }
+
+    // The small lists are looked up in the large ones
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().AddLevel(ERROR_LVL).SetBundleName("bundle")).size() == 5,
+                    "Wrong count for level and bundle");
+    ASSERT_TRUE_EXT(
+        pResultContainer->Query(cResultQuery().AddLevel(INFO_LVL).SetCheckerID("smallChecker")).empty(),
+        "Wrong count for disjoint level and checker");
+    ASSERT_TRUE_EXT(pResultContainer
+                            ->Query(cResultQuery()
+                                        .AddLevel(ERROR_LVL)
+                                        .AddLevel(WARNING_LVL)
+                                        .SetRuleUID("asam.net:xodr:1.7.0:small")
+                                        .SetBundleName("bundle"))
+                            .size() == 10,
+                    "Wrong count for several levels, rule and bundle");
+    ASSERT_TRUE_EXT(pResultContainer->Query(cResultQuery().SetRuleUIDPrefix("asam.net:xodr")).size() == 2010,
+                    "Wrong count for rule prefix");
+
+    delete pResultContainer;
+}
+
+TEST_F(cTesterResultFormat, ResultDiff)
+{
+    cResultContainer baseResults;
+    cResultContainer currentResults;
+
+    cCheckerBundle *pBaseBundle = new cCheckerBundle("xodrBundle", "", "");
+    baseResults.AddCheckerBundle(pBaseBundle);
+    cChecker *pBaseChecker = pBaseBundle->CreateChecker("roadChecker");
+
+    cCheckerBundle *pCurrentBundle = new cCheckerBundle("xodrBundle", "", "");
+    currentResults.AddCheckerBundle(pCurrentBundle);
+    cChecker *pCurrentChecker = pCurrentBundle->CreateChecker("roadChecker");
+
+    // Fixed in the current run
+    pBaseChecker->AddIssue(new cIssue("road 7 error", ERROR_LVL, "asam.net:xodr:1.7.0:road.id",
+                                      new cLocationsContainer("", new cXMLLocation("/OpenDRIVE/road[@id='7']"))));
+    // Unchanged, the issue id prefix and whitespace do not matter
+    pBaseChecker->AddIssue(new cIssue("road 8  warning", WARNING_LVL, "asam.net:xodr:1.7.0:road.id",
+                                      new cLocationsContainer("", new cXMLLocation("/OpenDRIVE/road[@id='8']"))));
+    pCurrentChecker->AddIssue(new cIssue("#12: road 8 warning ", WARNING_LVL, "asam.net:xodr:1.7.0:road.id",
+                                         new cLocationsContainer("", new cXMLLocation("/OpenDRIVE/road[@id='8']"))));
+    // Duplicates are matched pairwise, so one of them is new
+    pBaseChecker->AddIssue(new cIssue("geometry error", ERROR_LVL, "asam.net:xodr:1.7.0:geometry",
+                                      new cLocationsContainer("", new cInertialLocation(10.0, 20.0, 0.0))));
+    pCurrentChecker->AddIssue(new cIssue("geometry error", ERROR_LVL, "asam.net:xodr:1.7.0:geometry",
+                                         new cLocationsContainer("", new cInertialLocation(10.0, 20.0, 0.0))));
+    pCurrentChecker->AddIssue(new cIssue("geometry error", ERROR_LVL, "asam.net:xodr:1.7.0:geometry",
+                                         new cLocationsContainer("", new cInertialLocation(10.0, 20.0, 0.0))));
+    // Same finding at another location is new
+    pCurrentChecker->AddIssue(new cIssue("road 8 warning", WARNING_LVL, "asam.net:xodr:1.7.0:road.id",
+                                         new cLocationsContainer("", new cXMLLocation("/OpenDRIVE/road[@id='9']"))));
+
+    cResultDiff diff;
+    diff.Compare(baseResults, currentResults);
+
+    ASSERT_TRUE_EXT(diff.GetAdded().size() == 2, "Wrong count of added issues");
+    ASSERT_TRUE_EXT(diff.GetRemoved().size() == 1, "Wrong count of removed issues");
+    ASSERT_TRUE_EXT(diff.GetUnchanged().size() == 2, "Wrong count of unchanged issues");
+    ASSERT_TRUE_EXT(diff.GetRemoved()[0].issue->GetDescription() == "road 7 error", "Wrong removed issue");
+    ASSERT_TRUE_EXT(diff.GetRemoved()[0].checker == pBaseChecker, "Removed issue has to point into base results");
+    ASSERT_TRUE_EXT(diff.GetAdded()[0].checker == pCurrentChecker, "Added issue has to point into current results");
+
+    uint64_t fingerprint = 0;
+    const uint64_t expected =
+        cIssueFingerprint::Compute(pCurrentBundle, pCurrentChecker, diff.GetUnchanged()[0].issue);
+    ASSERT_TRUE_EXT(cIssueFingerprint::FromString(cIssueFingerprint::ToString(expected), fingerprint) &&
+                        fingerprint == expected,
+                    "Fingerprint has to survive the string conversion");
+}
+
+TEST_F(cTesterResultFormat, IssueBaseline)
+{
+    XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
+    std::string strFilePath = strTestFilesDir + "/result_domain_info.xqar";
+    std::string strBaselineFile = strWorkingDir + "/baseline.txt";
+
+    cResultContainer *pResultContainer = new cResultContainer();
+    pResultContainer->AddResultsFromXML(strFilePath);
+
+    std::vector<cIssueHandle> handles = pResultContainer->Query(cResultQuery());
+    const std::size_t issueCount = handles.size();
+    ASSERT_TRUE_EXT(issueCount > 0, "Result file has to contain issues");
+
+    // Accept the first issue and check the round trip through the baseline file
+    cIssueBaseline baseline;
+    baseline.Add(cIssueFingerprint::Compute(handles[0].bundle, handles[0].checker, handles[0].issue));
+    ASSERT_TRUE_EXT(baseline.WriteToFile(strBaselineFile), "Could not write baseline file");
+    delete pResultContainer;
+
+    cIssueBaseline loadedBaseline;
+    ASSERT_TRUE_EXT(loadedBaseline.LoadFromFile(strBaselineFile), "Could not read baseline file");
+    ASSERT_TRUE_EXT(loadedBaseline.GetCount() == 1, "Wrong count of fingerprints in baseline file");
+
+    // Suppressed issues are not created at all
+    pResultContainer = new cResultContainer();
+    pResultContainer->SetBaseline(&loadedBaseline);
+    pResultContainer->AddResultsFromXML(strFilePath);
+    ASSERT_TRUE_EXT(pResultContainer->GetIssueCount() + 1 == issueCount, "Baseline issue has to be dropped");
+    ASSERT_TRUE_EXT(loadedBaseline.GetSuppressedCount() == 1, "Wrong count of suppressed issues");
+    delete pResultContainer;
+
+    // Suppressed issues are created, but disabled
+    loadedBaseline.SetMode(BASELINE_DISABLE);
+    pResultContainer = new cResultContainer();
+    pResultContainer->SetBaseline(&loadedBaseline);
+    pResultContainer->AddResultsFromXML(strFilePath);
+    ASSERT_TRUE_EXT(pResultContainer->GetIssueCount() == issueCount, "Baseline issue has to be kept");
+    ASSERT_TRUE_EXT(pResultContainer->GetEnabledIssuesCount() + 1 == issueCount, "Baseline issue has to be disabled");
+    delete pResultContainer;
+
+    XERCES_CPP_NAMESPACE::XMLPlatformUtils::Terminate();
+}
+
+TEST_F(cTesterResultFormat, ReadInvalidResultFile)
+{
+    XERCES_CPP_NAMESPACE::XMLPlatformUtils::Initialize();
+    std::string strMalformedFile = strWorkingDir + "/malformed.xqar";
+    auto progress = [](uint64_t, uint64_t) { return true; };
+
+    std::ofstream malformedFile(strMalformedFile);
+    malformedFile << "<?xml version=\"1.0\"?>\n<CheckerResults version=\"1.0.0\">\n<CheckerBundle";
+    malformedFile.close();
+
+    cResultContainer *pResultContainer = new cResultContainer();
+    pResultContainer->AddCheckerBundle(new cCheckerBundle("existingBundle", "", ""));
+
+    // Failures are reported and keep the previous results
+    ASSERT_TRUE_EXT(!pResultContainer->AddResultsFromXML(strWorkingDir + "/missing.xqar", progress),
+                    "Missing file has to fail");
+    ASSERT_TRUE_EXT(!pResultContainer->AddResultsFromXML(strMalformedFile, progress), "Malformed file has to fail");
+    ASSERT_TRUE_EXT(pResultContainer->GetCheckerBundleCount() == 1, "Container has to be unchanged");
+
+    ASSERT_TRUE_EXT(pResultContainer->AddResultsFromXML(strTestFilesDir + "/result_domain_info.xqar", progress),
+                    "Valid file has to be read");
+    ASSERT_TRUE_EXT(pResultContainer->GetCheckerBundleCount() > 1, "Results have to be added");
+    delete pResultContainer;
+
+    XERCES_CPP_NAMESPACE::XMLPlatformUtils::Terminate();
+}
+
+TEST_F(cTesterResultFormat, LoggerCategoryLimit)
+{
+    cLogger &logger = cLogger::GetInstance();
+    const eLogLevel previousLevel = logger.GetLevel();
+    logger.SetLevel(LOG_WARNING_LVL);
+    logger.SetCategoryLimit(2);
+
+    const unsigned int warningCount = logger.GetMessageCount(LOG_WARNING_LVL);
+    const unsigned int suppressedCount = logger.GetSuppressedCount();
+
+    // Only the first messages of a category are written, all of them are counted
+    for (int i = 0; i < 5; i++)
+        LogWarning("LoggerCategoryLimit") << "Repeated warning " << i;
+
+    ASSERT_TRUE_EXT(logger.GetMessageCount(LOG_WARNING_LVL) == warningCount + 5, "Wrong count of warnings");
+    ASSERT_TRUE_EXT(logger.GetSuppressedCount() == suppressedCount + 3, "Wrong count of suppressed messages");
+
+    // Messages below the level are counted, but not suppressed
+    logger.SetLevel(LOG_ERROR_LVL);
+    for (int i = 0; i < 5; i++)
+        LogWarning("LoggerCategoryLimitDisabled") << "Disabled warning " << i;
+
+    ASSERT_TRUE_EXT(logger.GetMessageCount(LOG_WARNING_LVL) == warningCount + 10, "Wrong count of warnings");
+    ASSERT_TRUE_EXT(logger.GetSuppressedCount() == suppressedCount + 3, "Disabled messages must not be suppressed");
+
+    ASSERT_TRUE_EXT(cLogger::GetLogLevelFromStr("Debug", LOG_INFO_LVL) == LOG_DEBUG_LVL, "Wrong level for name");
+    ASSERT_TRUE_EXT(cLogger::GetLogLevelFromStr("unknown", LOG_INFO_LVL) == LOG_INFO_LVL, "Wrong default level");
+
+    logger.SetCategoryLimit(cLogger::DEFAULT_CATEGORY_LIMIT);
+    logger.SetLevel(previousLevel);
+    logger.Flush();
+}
+
+TEST_F(cTesterResultFormat, SwapContainers)
+{
+    cResultContainer loadedResults;
+    cResultContainer shownResults;
+
+    cCheckerBundle *pLoadedBundle = new cCheckerBundle("loadedBundle", "", "");
+    loadedResults.AddCheckerBundle(pLoadedBundle);
+    cChecker *pChecker = pLoadedBundle->CreateChecker("checker");
+    pChecker->AddIssue(new cIssue("first", ERROR_LVL, ""));
+    pChecker->AddIssue(new cIssue("second", WARNING_LVL, ""));
+
+    shownResults.AddCheckerBundle(new cCheckerBundle("shownBundle", "", ""));
+    ASSERT_TRUE_EXT(shownResults.Query(cResultQuery()).size() == 0, "Shown results must not contain issues");
+
+    shownResults.Swap(loadedResults);
+
+    ASSERT_TRUE_EXT(shownResults.GetCheckerBundles().front() == pLoadedBundle, "Bundles were not swapped");
+    ASSERT_TRUE_EXT(pLoadedBundle->GetResultContainer() == &shownResults, "Bundle refers to the old container");
+    ASSERT_TRUE_EXT(shownResults.GetIssueCount() == 2, "Wrong issue count after swap");
+    ASSERT_TRUE_EXT(shownResults.Query(cResultQuery()).size() == 2, "Query index was not invalidated");
+    ASSERT_TRUE_EXT(loadedResults.GetCheckerBundles().front()->GetBundleName() == "shownBundle",
+                    "Other container did not receive the bundles");
+}
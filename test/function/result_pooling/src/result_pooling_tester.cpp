@@ -16,6 +16,7 @@
 #include <xercesc/util/PlatformUtils.hpp>
 
 #define MODULE_NAME "ResultPooling"
+#define RESULT_DIFF_MODULE_NAME "ResultDiff"
 
 class cTesterResultPooling : public ::testing::Test
 {
@@ -129,3 +130,83 @@ TEST_F(cTesterResultPooling, CmdWithConfig)
 
     fs::remove(strResultFilePath.c_str());
 }
+
+TEST_F(cTesterResultPooling, CmdBaselineModeNotValid)
+{
+    std::string strResultMessage;
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strTestFilesDir + " --baseline_mode disabel");
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+}
+
+TEST_F(cTesterResultPooling, CmdBaselineMissingValue)
+{
+    std::string strResultMessage;
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strTestFilesDir + " --baseline");
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+}
+
+TEST_F(cTesterResultPooling, CmdBaselineFileNotFound)
+{
+    std::string strResultMessage;
+
+    std::string strConfigFilePath = strTestFilesDir + "/" + "two_bundles_config.xml";
+
+    TestResult nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                                     strTestFilesDir + " " + strConfigFilePath + " --baseline error.txt");
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+
+    nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strTestFilesDir + " --baseline error.txt");
+    ASSERT_TRUE(nRes == TestResult::ERR_FAILED);
+}
+
+TEST_F(cTesterResultPooling, CmdWithConfigAndBaseline)
+{
+    std::string strResultMessage;
+
+    std::string strResultFilePath = strWorkingDir + "/" + "Result.xqar";
+    std::string strConfigFilePath = strTestFilesDir + "/" + "two_bundles_config.xml";
+    std::string strBaselineSourcePath = strTestFilesDir + "/" + "DemoCheckerBundle2.xqar";
+    std::string strBaselineFilePath = strWorkingDir + "/" + "baseline.txt";
+
+    // Accept all issues of DemoCheckerBundle2
+    TestResult nRes = ExecuteCommand(strResultMessage, RESULT_DIFF_MODULE_NAME,
+                                     "--write_baseline " + strBaselineSourcePath + " " + strBaselineFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    unsigned int uiBaselineIssueCount = 0;
+    {
+        cResultContainer baselineResults;
+        baselineResults.AddResultsFromXML(strBaselineSourcePath);
+        uiBaselineIssueCount = baselineResults.GetIssueCount();
+    }
+    ASSERT_TRUE_EXT(uiBaselineIssueCount > 0, strResultMessage.c_str());
+
+    nRes = ExecuteCommand(strResultMessage, MODULE_NAME, strTestFilesDir + " " + strConfigFilePath);
+    ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+    unsigned int uiPooledIssueCount = 0;
+    {
+        cResultContainer pooledResults;
+        pooledResults.AddResultsFromXML(strResultFilePath);
+        uiPooledIssueCount = pooledResults.GetIssueCount();
+    }
+
+    // Both modes leave the accepted issues out of the pooled result file
+    for (const std::string strMode : {"drop", "disable"})
+    {
+        nRes = ExecuteCommand(strResultMessage, MODULE_NAME,
+                              strTestFilesDir + " " + strConfigFilePath + " --baseline " + strBaselineFilePath +
+                                  " --baseline_mode " + strMode);
+        ASSERT_TRUE_EXT(nRes == TestResult::ERR_NOERROR, strResultMessage.c_str());
+
+        cResultContainer baselinedResults;
+        baselinedResults.AddResultsFromXML(strResultFilePath);
+        ASSERT_TRUE_EXT(baselinedResults.GetIssueCount() == uiPooledIssueCount - uiBaselineIssueCount,
+                        strResultMessage.c_str());
+    }
+
+    fs::remove(strResultFilePath.c_str());
+    fs::remove(strBaselineFilePath.c_str());
+}